@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "accuracy-accumulator.hpp"
+
+/////////////////////////////////////////////////////////// | Using declarations
+template <typename Scalar>
+using MatrixReference = Eigen::Ref<Eigen::MatrixX<Scalar> const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    //////////////////////////////////////// | Class: BasicAccuracyAccumulator <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    template <typename Scalar>
+    BasicAccuracyAccumulator<Scalar>::BasicAccuracyAccumulator
+            ()
+            :
+            accurateClassificationsCount { 0 },
+            examplesCount { 0 }
+    {
+    }
+
+    //------------- | Interface: BasicEvaluationAccumulator | Implementation <<<
+    template <typename Scalar>
+    void BasicAccuracyAccumulator<Scalar>::accumulate
+            (MatrixReference<Scalar> const &outputs,
+             MatrixReference<Scalar> const &targets)
+    {
+        for (Eigen::Index i = 0; i < outputs.cols(); ++i)
+        {
+            Eigen::Index predictedClass, actualClass;
+            outputs.col(i).maxCoeff(&predictedClass);
+            targets.col(i).maxCoeff(&actualClass);
+
+            accurateClassificationsCount += (predictedClass == actualClass);
+        }
+
+        examplesCount += outputs.cols();
+    }
+
+    template <typename Scalar>
+    void BasicAccuracyAccumulator<Scalar>::reset
+            ()
+    {
+        accurateClassificationsCount = 0;
+        examplesCount = 0;
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    template <typename Scalar>
+    double BasicAccuracyAccumulator<Scalar>::accuracy
+            () const
+    {
+        return examplesCount > 0
+               ? static_cast<double>(accurateClassificationsCount)
+                 / examplesCount
+               : 0.0;
+    }
+
+    template <typename Scalar>
+    long BasicAccuracyAccumulator<Scalar>::numberOfAccurateClassifications
+            () const
+    {
+        return accurateClassificationsCount;
+    }
+
+    template <typename Scalar>
+    long BasicAccuracyAccumulator<Scalar>::numberOfExamples
+            () const
+    {
+        return examplesCount;
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicAccuracyAccumulator<float>;
+    template class BasicAccuracyAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
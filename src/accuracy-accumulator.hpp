@@ -0,0 +1,55 @@
+#ifndef IAD_2A_ACCURACY_ACCUMULATOR_HPP
+#define IAD_2A_ACCURACY_ACCUMULATOR_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "evaluation-accumulator.hpp"
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    //////////////////////////////////////// | Class: BasicAccuracyAccumulator <
+    template <typename Scalar>
+    class BasicAccuracyAccumulator final
+            : public BasicEvaluationAccumulator<Scalar>
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        BasicAccuracyAccumulator
+                ();
+
+        //----------------------------------------------------- | Destructor <<<
+        ~BasicAccuracyAccumulator
+                () noexcept final = default;
+
+        //--------- | Interface: BasicEvaluationAccumulator | Implementation <<<
+        // The predicted and actual classes are the indices of the largest
+        // output and target
+        void accumulate
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &targets) final;
+
+        void reset
+                () final;
+
+        //--------------------------------------------------------- | Traits <<<
+        double accuracy
+                () const;
+
+        long numberOfAccurateClassifications
+                () const;
+
+        long numberOfExamples
+                () const;
+
+    private:
+        //============================================================ | Data <<
+        long accurateClassificationsCount;
+        long examplesCount;
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using AccuracyAccumulator = BasicAccuracyAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_ACCURACY_ACCUMULATOR_HPP
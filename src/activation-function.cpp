@@ -4,11 +4,16 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    ////////////////////////////////////////// | Interface: ActivationFunction <
+    ///////////////////////////////////// | Interface: BasicActivationFunction <
     //=========================================================== | Behaviour <<
     //--------------------------------------------------------- | Destructor <<<
-    ActivationFunction::~ActivationFunction
+    template <typename Scalar>
+    BasicActivationFunction<Scalar>::~BasicActivationFunction
             () noexcept = default;
+
+    //============================================== | Explicit instantiation <<
+    template class BasicActivationFunction<float>;
+    template class BasicActivationFunction<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -9,52 +9,72 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    ////////////////////////////////////////// | Interface: ActivationFunction <
-    class ActivationFunction
-            : private Cloneable<ActivationFunction>
+    ///////////////////////////////////// | Interface: BasicActivationFunction <
+    template <typename Scalar>
+    class BasicActivationFunction
+            : private Cloneable<BasicActivationFunction<Scalar>>
     {
     public:
         //======================================================= | Behaviour <<
         //----------------------------------------------------- | Destructor <<<
-        ~ActivationFunction
+        ~BasicActivationFunction
                 () noexcept override = 0;
 
         //-------------------------- | Interface: Cloneable | Implementation <<<
-        std::unique_ptr<ActivationFunction> clone
+        std::unique_ptr<BasicActivationFunction> clone
                 () const override = 0;
 
-        operator std::unique_ptr<ActivationFunction>
+        operator std::unique_ptr<BasicActivationFunction>
                 () const override
         {
             return clone();
         }
 
         //----------------------------------------------------------- | Main <<<
-        virtual Eigen::ArrayXd operator()
-                (Eigen::ArrayXd const &input) const = 0;
+        virtual Eigen::ArrayX<Scalar> operator()
+                (Eigen::ArrayX<Scalar> const &input) const = 0;
 
-        virtual Eigen::ArrayXd derivative
-                (Eigen::ArrayXd const &input) const = 0;
+        virtual Eigen::ArrayX<Scalar> derivative
+                (Eigen::ArrayX<Scalar> const &input) const = 0;
+
+        //---------------------------------------------------------- | Batch <<<
+        // Write into caller-provided buffers of the same shape as inputs
+        virtual void activateBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs) const = 0;
+
+        virtual void derivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const = 0;
+
+        // Computes both in one pass, sharing intermediate results
+        virtual void activateWithDerivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const = 0;
 
     protected:
         //======================================================= | Behaviour <<
         //--------------------------------------------------- | Constructors <<<
-        ActivationFunction
+        BasicActivationFunction
                 () = default;
 
-        ActivationFunction
-                (ActivationFunction const &) = default;
+        BasicActivationFunction
+                (BasicActivationFunction const &) = default;
 
-        ActivationFunction
-                (ActivationFunction &&) = default;
+        BasicActivationFunction
+                (BasicActivationFunction &&) = default;
 
         //------------------------------------------------------ | Operators <<<
-        ActivationFunction &operator=
-                (ActivationFunction const &) = default;
+        BasicActivationFunction &operator=
+                (BasicActivationFunction const &) = default;
 
-        ActivationFunction &operator=
-                (ActivationFunction &&) = default;
+        BasicActivationFunction &operator=
+                (BasicActivationFunction &&) = default;
     };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using ActivationFunction = BasicActivationFunction<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,252 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "activation-kernels-implementation.hpp"
+
+#include <immintrin.h>
+
+// Compiled with -mavx2 -mfma
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////// | Namespace: ActivationKernels <
+    namespace ActivationKernels
+    {
+        ////////////////////////////////////////// | Struct: Avx2Operations <
+        template <typename Scalar>
+        struct Avx2Operations;
+
+        template <>
+        struct Avx2Operations<float>
+        {
+            using Scalar = float;
+            using Pack = __m256;
+
+            static constexpr int width = 8;
+
+            static Pack load
+                    (Scalar const *source)
+            {
+                return _mm256_loadu_ps(source);
+            }
+
+            static void store
+                    (Scalar *target, Pack a)
+            {
+                _mm256_storeu_ps(target, a);
+            }
+
+            static Pack broadcast
+                    (Scalar a)
+            {
+                return _mm256_set1_ps(a);
+            }
+
+            static Pack add
+                    (Pack a, Pack b)
+            {
+                return _mm256_add_ps(a, b);
+            }
+
+            static Pack subtract
+                    (Pack a, Pack b)
+            {
+                return _mm256_sub_ps(a, b);
+            }
+
+            static Pack multiply
+                    (Pack a, Pack b)
+            {
+                return _mm256_mul_ps(a, b);
+            }
+
+            static Pack divide
+                    (Pack a, Pack b)
+            {
+                return _mm256_div_ps(a, b);
+            }
+
+            static Pack multiplyAdd
+                    (Pack a, Pack b, Pack c)
+            {
+                return _mm256_fmadd_ps(a, b, c);
+            }
+
+            static Pack minimum
+                    (Pack a, Pack b)
+            {
+                return _mm256_min_ps(a, b);
+            }
+
+            static Pack maximum
+                    (Pack a, Pack b)
+            {
+                return _mm256_max_ps(a, b);
+            }
+
+            static Pack round
+                    (Pack a)
+            {
+                return _mm256_round_ps
+                        (a,
+                         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+
+            static Pack selectPositive
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm256_blendv_ps
+                        (b,
+                         a,
+                         _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+            }
+
+            static Pack selectNegative
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm256_blendv_ps
+                        (b,
+                         a,
+                         _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+            }
+
+            // 2^n for integral n: adding the magic number leaves n plus
+            // the exponent bias in the low bits, which are then shifted into
+            // the exponent field
+            static Pack exponentOfTwo
+                    (Pack n)
+            {
+                Pack const biased
+                        = _mm256_add_ps(n, _mm256_set1_ps(8388608.0f + 127.0f));
+
+                return _mm256_castsi256_ps
+                        (_mm256_slli_epi32(_mm256_castps_si256(biased), 23));
+            }
+        };
+
+        template <>
+        struct Avx2Operations<double>
+        {
+            using Scalar = double;
+            using Pack = __m256d;
+
+            static constexpr int width = 4;
+
+            static Pack load
+                    (Scalar const *source)
+            {
+                return _mm256_loadu_pd(source);
+            }
+
+            static void store
+                    (Scalar *target, Pack a)
+            {
+                _mm256_storeu_pd(target, a);
+            }
+
+            static Pack broadcast
+                    (Scalar a)
+            {
+                return _mm256_set1_pd(a);
+            }
+
+            static Pack add
+                    (Pack a, Pack b)
+            {
+                return _mm256_add_pd(a, b);
+            }
+
+            static Pack subtract
+                    (Pack a, Pack b)
+            {
+                return _mm256_sub_pd(a, b);
+            }
+
+            static Pack multiply
+                    (Pack a, Pack b)
+            {
+                return _mm256_mul_pd(a, b);
+            }
+
+            static Pack divide
+                    (Pack a, Pack b)
+            {
+                return _mm256_div_pd(a, b);
+            }
+
+            static Pack multiplyAdd
+                    (Pack a, Pack b, Pack c)
+            {
+                return _mm256_fmadd_pd(a, b, c);
+            }
+
+            static Pack minimum
+                    (Pack a, Pack b)
+            {
+                return _mm256_min_pd(a, b);
+            }
+
+            static Pack maximum
+                    (Pack a, Pack b)
+            {
+                return _mm256_max_pd(a, b);
+            }
+
+            static Pack round
+                    (Pack a)
+            {
+                return _mm256_round_pd
+                        (a,
+                         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+
+            static Pack selectPositive
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm256_blendv_pd
+                        (b,
+                         a,
+                         _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_GT_OQ));
+            }
+
+            static Pack selectNegative
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm256_blendv_pd
+                        (b,
+                         a,
+                         _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LT_OQ));
+            }
+
+            // 2^n for integral n: adding the magic number leaves n plus
+            // the exponent bias in the low bits, which are then shifted into
+            // the exponent field
+            static Pack exponentOfTwo
+                    (Pack n)
+            {
+                Pack const biased
+                        = _mm256_add_pd
+                                (n,
+                                 _mm256_set1_pd(4503599627370496.0 + 1023.0));
+
+                return _mm256_castsi256_pd
+                        (_mm256_slli_epi64(_mm256_castpd_si256(biased), 52));
+            }
+        };
+
+        template <>
+        KernelTable<float> const &avx2Kernels<float>
+                ()
+        {
+            return Implementation<Avx2Operations<float>>::table();
+        }
+
+        template <>
+        KernelTable<double> const &avx2Kernels<double>
+                ()
+        {
+            return Implementation<Avx2Operations<double>>::table();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
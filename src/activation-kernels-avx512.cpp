@@ -0,0 +1,252 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "activation-kernels-implementation.hpp"
+
+#include <immintrin.h>
+
+// Compiled with -mavx512f
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////// | Namespace: ActivationKernels <
+    namespace ActivationKernels
+    {
+        //////////////////////////////////////// | Struct: Avx512Operations <
+        template <typename Scalar>
+        struct Avx512Operations;
+
+        template <>
+        struct Avx512Operations<float>
+        {
+            using Scalar = float;
+            using Pack = __m512;
+
+            static constexpr int width = 16;
+
+            static Pack load
+                    (Scalar const *source)
+            {
+                return _mm512_loadu_ps(source);
+            }
+
+            static void store
+                    (Scalar *target, Pack a)
+            {
+                _mm512_storeu_ps(target, a);
+            }
+
+            static Pack broadcast
+                    (Scalar a)
+            {
+                return _mm512_set1_ps(a);
+            }
+
+            static Pack add
+                    (Pack a, Pack b)
+            {
+                return _mm512_add_ps(a, b);
+            }
+
+            static Pack subtract
+                    (Pack a, Pack b)
+            {
+                return _mm512_sub_ps(a, b);
+            }
+
+            static Pack multiply
+                    (Pack a, Pack b)
+            {
+                return _mm512_mul_ps(a, b);
+            }
+
+            static Pack divide
+                    (Pack a, Pack b)
+            {
+                return _mm512_div_ps(a, b);
+            }
+
+            static Pack multiplyAdd
+                    (Pack a, Pack b, Pack c)
+            {
+                return _mm512_fmadd_ps(a, b, c);
+            }
+
+            static Pack minimum
+                    (Pack a, Pack b)
+            {
+                return _mm512_min_ps(a, b);
+            }
+
+            static Pack maximum
+                    (Pack a, Pack b)
+            {
+                return _mm512_max_ps(a, b);
+            }
+
+            static Pack round
+                    (Pack a)
+            {
+                return _mm512_roundscale_ps
+                        (a,
+                         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+
+            static Pack selectPositive
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm512_mask_blend_ps
+                        (_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_GT_OQ),
+                         b,
+                         a);
+            }
+
+            static Pack selectNegative
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm512_mask_blend_ps
+                        (_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_LT_OQ),
+                         b,
+                         a);
+            }
+
+            // 2^n for integral n: adding the magic number leaves n plus
+            // the exponent bias in the low bits, which are then shifted into
+            // the exponent field
+            static Pack exponentOfTwo
+                    (Pack n)
+            {
+                Pack const biased
+                        = _mm512_add_ps(n, _mm512_set1_ps(8388608.0f + 127.0f));
+
+                return _mm512_castsi512_ps
+                        (_mm512_slli_epi32(_mm512_castps_si512(biased), 23));
+            }
+        };
+
+        template <>
+        struct Avx512Operations<double>
+        {
+            using Scalar = double;
+            using Pack = __m512d;
+
+            static constexpr int width = 8;
+
+            static Pack load
+                    (Scalar const *source)
+            {
+                return _mm512_loadu_pd(source);
+            }
+
+            static void store
+                    (Scalar *target, Pack a)
+            {
+                _mm512_storeu_pd(target, a);
+            }
+
+            static Pack broadcast
+                    (Scalar a)
+            {
+                return _mm512_set1_pd(a);
+            }
+
+            static Pack add
+                    (Pack a, Pack b)
+            {
+                return _mm512_add_pd(a, b);
+            }
+
+            static Pack subtract
+                    (Pack a, Pack b)
+            {
+                return _mm512_sub_pd(a, b);
+            }
+
+            static Pack multiply
+                    (Pack a, Pack b)
+            {
+                return _mm512_mul_pd(a, b);
+            }
+
+            static Pack divide
+                    (Pack a, Pack b)
+            {
+                return _mm512_div_pd(a, b);
+            }
+
+            static Pack multiplyAdd
+                    (Pack a, Pack b, Pack c)
+            {
+                return _mm512_fmadd_pd(a, b, c);
+            }
+
+            static Pack minimum
+                    (Pack a, Pack b)
+            {
+                return _mm512_min_pd(a, b);
+            }
+
+            static Pack maximum
+                    (Pack a, Pack b)
+            {
+                return _mm512_max_pd(a, b);
+            }
+
+            static Pack round
+                    (Pack a)
+            {
+                return _mm512_roundscale_pd
+                        (a,
+                         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+
+            static Pack selectPositive
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm512_mask_blend_pd
+                        (_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_GT_OQ),
+                         b,
+                         a);
+            }
+
+            static Pack selectNegative
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm512_mask_blend_pd
+                        (_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_LT_OQ),
+                         b,
+                         a);
+            }
+
+            // 2^n for integral n: adding the magic number leaves n plus
+            // the exponent bias in the low bits, which are then shifted into
+            // the exponent field
+            static Pack exponentOfTwo
+                    (Pack n)
+            {
+                Pack const biased
+                        = _mm512_add_pd
+                                (n,
+                                 _mm512_set1_pd(4503599627370496.0 + 1023.0));
+
+                return _mm512_castsi512_pd
+                        (_mm512_slli_epi64(_mm512_castpd_si512(biased), 52));
+            }
+        };
+
+        template <>
+        KernelTable<float> const &avx512Kernels<float>
+                ()
+        {
+            return Implementation<Avx512Operations<float>>::table();
+        }
+
+        template <>
+        KernelTable<double> const &avx512Kernels<double>
+                ()
+        {
+            return Implementation<Avx512Operations<double>>::table();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,471 @@
+#ifndef IAD_2A_ACTIVATION_KERNELS_IMPLEMENTATION_HPP
+#define IAD_2A_ACTIVATION_KERNELS_IMPLEMENTATION_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include <cstddef>
+
+// Internal to the activation kernels. Every instruction set's translation
+// unit instantiates Implementation with its own Operations type, so code
+// compiled for different instruction sets never shares a symbol. Eigen is
+// deliberately not included, as it would be vectorised for the instruction
+// set of whichever translation unit included it.
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////// | Namespace: ActivationKernels <
+    namespace ActivationKernels
+    {
+        ///////////////////////////////////////////// | Struct: KernelTable <
+        template <typename Scalar>
+        struct KernelTable
+        {
+            void (*sigmoid)
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t size,
+                     int exponentialDegree);
+
+            void (*rectifiedLinearUnit)
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t size);
+
+            void (*parametricRectifiedLinearUnit)
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t size,
+                     Scalar parameter);
+
+            void (*identity)
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t size);
+
+            void (*squaredDistances)
+                    (Scalar const *points,
+                     std::ptrdiff_t numberOfDimensions,
+                     std::ptrdiff_t numberOfPoints,
+                     Scalar const *query,
+                     Scalar *squaredDistances);
+
+            void (*boundedSquaredDistances)
+                    (Scalar const *points,
+                     std::ptrdiff_t numberOfDimensions,
+                     std::ptrdiff_t numberOfPoints,
+                     Scalar const *query,
+                     int const *segments,
+                     std::ptrdiff_t numberOfSegments,
+                     std::ptrdiff_t segmentSize,
+                     Scalar bound,
+                     Scalar *squaredDistances);
+        };
+
+        //------------------------------------ | Tables per instruction set <<<
+        template <typename Scalar>
+        KernelTable<Scalar> const &genericKernels
+                ();
+
+        template <typename Scalar>
+        KernelTable<Scalar> const &sse42Kernels
+                ();
+
+        template <typename Scalar>
+        KernelTable<Scalar> const &avx2Kernels
+                ();
+
+        template <typename Scalar>
+        KernelTable<Scalar> const &avx512Kernels
+                ();
+
+        ///////////////////////////////////////// | Struct: ScalarConstants <
+        template <typename Scalar>
+        struct ScalarConstants;
+
+        template <>
+        struct ScalarConstants<float>
+        {
+            // Keep 2^n a normal number
+            static constexpr float minimumExponent = -87.0f;
+            static constexpr float maximumExponent = 88.0f;
+
+            // ln 2 split so that n * ln2High is exact
+            static constexpr float ln2High = 0.693359375f;
+            static constexpr float ln2Low = -2.12194440e-4f;
+
+            static constexpr int maximumDegree = 8;
+        };
+
+        template <>
+        struct ScalarConstants<double>
+        {
+            static constexpr double minimumExponent = -708.0;
+            static constexpr double maximumExponent = 709.0;
+
+            static constexpr double ln2High = 6.93145751953125e-1;
+            static constexpr double ln2Low = 1.42860682030941723212e-6;
+
+            static constexpr int maximumDegree = 13;
+        };
+
+        ////////////////////////////////////////// | Struct: Implementation <
+        // Kernels written once against the pack operations of an instruction
+        // set: load, store, broadcast, arithmetic, rounding, 2^n and selection
+        // by sign
+        template <typename Operations>
+        struct Implementation
+        {
+            //=================================================== | Types <<
+            using Scalar = typename Operations::Scalar;
+            using Pack = typename Operations::Pack;
+            using Constants = ScalarConstants<Scalar>;
+
+            static constexpr int width = Operations::width;
+
+            //=============================================== | Behaviour <<
+            //------------------------------------------------- | Kernels <<<
+            static void sigmoid
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t const size,
+                     int const exponentialDegree)
+            {
+                Pack coefficients[Constants::maximumDegree + 1];
+                calculateCoefficients(coefficients, exponentialDegree);
+
+                forEachPack(inputs, outputs, derivatives, size,
+                            [&coefficients, exponentialDegree]
+                                    (Pack const input,
+                                     Pack &output,
+                                     Pack &derivative)
+                            {
+                                Pack const one = Operations::broadcast(1);
+                                Pack const negatedInput
+                                        = Operations::subtract
+                                                (Operations::broadcast(0),
+                                                 input);
+
+                                output = Operations::divide
+                                        (one,
+                                         Operations::add
+                                                 (one,
+                                                  exponential
+                                                          (negatedInput,
+                                                           coefficients,
+                                                           exponentialDegree)));
+                                derivative = Operations::multiply
+                                        (output,
+                                         Operations::subtract(one, output));
+                            });
+            }
+
+            static void rectifiedLinearUnit
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t const size)
+            {
+                forEachPack(inputs, outputs, derivatives, size,
+                            [](Pack const input,
+                               Pack &output,
+                               Pack &derivative)
+                            {
+                                Pack const zero = Operations::broadcast(0);
+
+                                output = Operations::selectPositive
+                                        (input, input, zero);
+                                derivative = Operations::selectPositive
+                                        (input, Operations::broadcast(1), zero);
+                            });
+            }
+
+            static void parametricRectifiedLinearUnit
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t const size,
+                     Scalar const parameter)
+            {
+                forEachPack(inputs, outputs, derivatives, size,
+                            [parameter](Pack const input,
+                                        Pack &output,
+                                        Pack &derivative)
+                            {
+                                Pack const slope
+                                        = Operations::broadcast(parameter);
+
+                                output = Operations::selectPositive
+                                        (input,
+                                         input,
+                                         Operations::multiply(slope, input));
+
+                                // Zero at zero, as the Eigen version
+                                derivative = Operations::selectPositive
+                                        (input,
+                                         Operations::broadcast(1),
+                                         Operations::selectNegative
+                                                 (input,
+                                                  slope,
+                                                  Operations::broadcast(0)));
+                            });
+            }
+
+            static void identity
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t const size)
+            {
+                forEachPack(inputs, outputs, derivatives, size,
+                            [](Pack const input,
+                               Pack &output,
+                               Pack &derivative)
+                            {
+                                output = input;
+                                derivative = Operations::broadcast(1);
+                            });
+            }
+
+            static void squaredDistances
+                    (Scalar const *points,
+                     std::ptrdiff_t const numberOfDimensions,
+                     std::ptrdiff_t const numberOfPoints,
+                     Scalar const *query,
+                     Scalar *squaredDistances)
+            {
+                for (std::ptrdiff_t k = 0; k < numberOfPoints; ++k)
+                    squaredDistances[k] = sumOfSquaredDifferences
+                            (points + k * numberOfDimensions,
+                             query,
+                             numberOfDimensions);
+            }
+
+            static void boundedSquaredDistances
+                    (Scalar const *points,
+                     std::ptrdiff_t const numberOfDimensions,
+                     std::ptrdiff_t const numberOfPoints,
+                     Scalar const *query,
+                     int const *segments,
+                     std::ptrdiff_t const numberOfSegments,
+                     std::ptrdiff_t const segmentSize,
+                     Scalar const bound,
+                     Scalar *squaredDistances)
+            {
+                std::ptrdiff_t const remainder
+                        = numberOfSegments * segmentSize;
+
+                for (std::ptrdiff_t k = 0; k < numberOfPoints; ++k)
+                {
+                    Scalar const *const point = points + k * numberOfDimensions;
+
+                    // Segments restart their packs, so that their sums do
+                    // not wait for each other
+                    Scalar sum = 0;
+
+                    for (std::ptrdiff_t s = 0;
+                         s < numberOfSegments && sum < bound;
+                         ++s)
+                    {
+                        std::ptrdiff_t const first = segments[s] * segmentSize;
+
+                        sum += sumOfSquaredDifferences
+                                (point + first, query + first, segmentSize);
+                    }
+
+                    if (sum < bound)
+                        sum += sumOfSquaredDifferences
+                                (point + remainder,
+                                 query + remainder,
+                                 numberOfDimensions - remainder);
+
+                    squaredDistances[k] = sum;
+                }
+            }
+
+            static KernelTable<Scalar> const &table
+                    ()
+            {
+                static KernelTable<Scalar> const kernels
+                        { &sigmoid,
+                          &rectifiedLinearUnit,
+                          &parametricRectifiedLinearUnit,
+                          &identity,
+                          &squaredDistances,
+                          &boundedSquaredDistances };
+
+                return kernels;
+            }
+
+            //---------------------------------------- | Helper functions <<<
+            static Scalar sumOfSquaredDifferences
+                    (Scalar const *point,
+                     Scalar const *query,
+                     std::ptrdiff_t const size)
+            {
+                // Two accumulators hide the latency of multiplyAdd
+                Pack sums[2] = { Operations::broadcast(0),
+                                 Operations::broadcast(0) };
+
+                std::ptrdiff_t i = 0;
+                for (; i + 2 * width <= size; i += 2 * width)
+                    for (int j = 0; j < 2; ++j)
+                    {
+                        Pack const difference = Operations::subtract
+                                (Operations::load(point + i + j * width),
+                                 Operations::load(query + i + j * width));
+
+                        sums[j] = Operations::multiplyAdd
+                                (difference, difference, sums[j]);
+                    }
+
+                Scalar lanes[width];
+                Operations::store(lanes, Operations::add(sums[0], sums[1]));
+
+                Scalar sum = 0;
+                for (int j = 0; j < width; ++j)
+                    sum += lanes[j];
+
+                for (; i < size; ++i)
+                    sum += (point[i] - query[i]) * (point[i] - query[i]);
+
+                return sum;
+            }
+
+            // Taylor coefficients 1 / k! of e^r
+            static void calculateCoefficients
+                    (Pack *coefficients,
+                     int const degree)
+            {
+                Scalar coefficient = 1;
+
+                for (int k = 0; k <= degree; ++k)
+                {
+                    if (k > 0)
+                        coefficient /= k;
+
+                    coefficients[k] = Operations::broadcast(coefficient);
+                }
+            }
+
+            // e^x = 2^n * e^r with n = round(x / ln 2) and |r| <= ln 2 / 2,
+            // e^r from its Taylor polynomial of the given degree
+            static Pack exponential
+                    (Pack input,
+                     Pack const *coefficients,
+                     int const degree)
+            {
+                input = Operations::minimum
+                        (Operations::maximum
+                                 (input,
+                                  Operations::broadcast
+                                          (Constants::minimumExponent)),
+                         Operations::broadcast(Constants::maximumExponent));
+
+                Pack const n = Operations::round
+                        (Operations::multiply
+                                 (input,
+                                  Operations::broadcast
+                                          (Scalar(1.44269504088896340736))));
+
+                Pack r = Operations::multiplyAdd
+                        (n,
+                         Operations::broadcast(-Constants::ln2High),
+                         input);
+                r = Operations::multiplyAdd
+                        (n,
+                         Operations::broadcast(-Constants::ln2Low),
+                         r);
+
+                // Horner's scheme
+                Pack polynomial = coefficients[degree];
+                for (int k = degree - 1; k >= 0; --k)
+                    polynomial = Operations::multiplyAdd(polynomial,
+                                                         r,
+                                                         coefficients[k]);
+
+                return Operations::multiply(polynomial,
+                                            Operations::exponentOfTwo(n));
+            }
+
+            template <bool CalculateOutputs,
+                      bool CalculateDerivatives,
+                      typename Function>
+            static void forEachPack
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t const size,
+                     Function const &function)
+            {
+                Pack output, derivative;
+
+                std::ptrdiff_t i = 0;
+                for (; i + width <= size; i += width)
+                {
+                    function(Operations::load(inputs + i),
+                             output,
+                             derivative);
+
+                    if constexpr (CalculateOutputs)
+                        Operations::store(outputs + i, output);
+
+                    if constexpr (CalculateDerivatives)
+                        Operations::store(derivatives + i, derivative);
+                }
+
+                if (i == size)
+                    return;
+
+                // Remainder goes through a zero-padded pack
+                Scalar inputsRemainder[width] = {};
+                Scalar outputsRemainder[width];
+                Scalar derivativesRemainder[width];
+
+                for (std::ptrdiff_t j = 0; i + j < size; ++j)
+                    inputsRemainder[j] = inputs[i + j];
+
+                function(Operations::load(inputsRemainder),
+                         output,
+                         derivative);
+
+                Operations::store(outputsRemainder, output);
+                Operations::store(derivativesRemainder, derivative);
+
+                for (std::ptrdiff_t j = 0; i + j < size; ++j)
+                {
+                    if constexpr (CalculateOutputs)
+                        outputs[i + j] = outputsRemainder[j];
+
+                    if constexpr (CalculateDerivatives)
+                        derivatives[i + j] = derivativesRemainder[j];
+                }
+            }
+
+            template <typename Function>
+            static void forEachPack
+                    (Scalar const *inputs,
+                     Scalar *outputs,
+                     Scalar *derivatives,
+                     std::ptrdiff_t const size,
+                     Function const &function)
+            {
+                if (outputs != nullptr && derivatives != nullptr)
+                    forEachPack<true, true>
+                            (inputs, outputs, derivatives, size, function);
+                else if (outputs != nullptr)
+                    forEachPack<true, false>
+                            (inputs, outputs, derivatives, size, function);
+                else if (derivatives != nullptr)
+                    forEachPack<false, true>
+                            (inputs, outputs, derivatives, size, function);
+            }
+        };
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif //IAD_2A_ACTIVATION_KERNELS_IMPLEMENTATION_HPP
@@ -0,0 +1,252 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "activation-kernels-implementation.hpp"
+
+#include <immintrin.h>
+
+// Compiled with -msse4.2
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////// | Namespace: ActivationKernels <
+    namespace ActivationKernels
+    {
+        ///////////////////////////////////////// | Struct: Sse42Operations <
+        template <typename Scalar>
+        struct Sse42Operations;
+
+        template <>
+        struct Sse42Operations<float>
+        {
+            using Scalar = float;
+            using Pack = __m128;
+
+            static constexpr int width = 4;
+
+            static Pack load
+                    (Scalar const *source)
+            {
+                return _mm_loadu_ps(source);
+            }
+
+            static void store
+                    (Scalar *target, Pack a)
+            {
+                _mm_storeu_ps(target, a);
+            }
+
+            static Pack broadcast
+                    (Scalar a)
+            {
+                return _mm_set1_ps(a);
+            }
+
+            static Pack add
+                    (Pack a, Pack b)
+            {
+                return _mm_add_ps(a, b);
+            }
+
+            static Pack subtract
+                    (Pack a, Pack b)
+            {
+                return _mm_sub_ps(a, b);
+            }
+
+            static Pack multiply
+                    (Pack a, Pack b)
+            {
+                return _mm_mul_ps(a, b);
+            }
+
+            static Pack divide
+                    (Pack a, Pack b)
+            {
+                return _mm_div_ps(a, b);
+            }
+
+            static Pack multiplyAdd
+                    (Pack a, Pack b, Pack c)
+            {
+                return _mm_add_ps(_mm_mul_ps(a, b), c);
+            }
+
+            static Pack minimum
+                    (Pack a, Pack b)
+            {
+                return _mm_min_ps(a, b);
+            }
+
+            static Pack maximum
+                    (Pack a, Pack b)
+            {
+                return _mm_max_ps(a, b);
+            }
+
+            static Pack round
+                    (Pack a)
+            {
+                return _mm_round_ps
+                        (a,
+                         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+
+            static Pack selectPositive
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm_blendv_ps
+                        (b,
+                         a,
+                         _mm_cmpgt_ps(x, _mm_setzero_ps()));
+            }
+
+            static Pack selectNegative
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm_blendv_ps
+                        (b,
+                         a,
+                         _mm_cmplt_ps(x, _mm_setzero_ps()));
+            }
+
+            // 2^n for integral n: adding the magic number leaves n plus
+            // the exponent bias in the low bits, which are then shifted into
+            // the exponent field
+            static Pack exponentOfTwo
+                    (Pack n)
+            {
+                Pack const biased
+                        = _mm_add_ps(n, _mm_set1_ps(8388608.0f + 127.0f));
+
+                return _mm_castsi128_ps
+                        (_mm_slli_epi32(_mm_castps_si128(biased), 23));
+            }
+        };
+
+        template <>
+        struct Sse42Operations<double>
+        {
+            using Scalar = double;
+            using Pack = __m128d;
+
+            static constexpr int width = 2;
+
+            static Pack load
+                    (Scalar const *source)
+            {
+                return _mm_loadu_pd(source);
+            }
+
+            static void store
+                    (Scalar *target, Pack a)
+            {
+                _mm_storeu_pd(target, a);
+            }
+
+            static Pack broadcast
+                    (Scalar a)
+            {
+                return _mm_set1_pd(a);
+            }
+
+            static Pack add
+                    (Pack a, Pack b)
+            {
+                return _mm_add_pd(a, b);
+            }
+
+            static Pack subtract
+                    (Pack a, Pack b)
+            {
+                return _mm_sub_pd(a, b);
+            }
+
+            static Pack multiply
+                    (Pack a, Pack b)
+            {
+                return _mm_mul_pd(a, b);
+            }
+
+            static Pack divide
+                    (Pack a, Pack b)
+            {
+                return _mm_div_pd(a, b);
+            }
+
+            static Pack multiplyAdd
+                    (Pack a, Pack b, Pack c)
+            {
+                return _mm_add_pd(_mm_mul_pd(a, b), c);
+            }
+
+            static Pack minimum
+                    (Pack a, Pack b)
+            {
+                return _mm_min_pd(a, b);
+            }
+
+            static Pack maximum
+                    (Pack a, Pack b)
+            {
+                return _mm_max_pd(a, b);
+            }
+
+            static Pack round
+                    (Pack a)
+            {
+                return _mm_round_pd
+                        (a,
+                         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+
+            static Pack selectPositive
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm_blendv_pd
+                        (b,
+                         a,
+                         _mm_cmpgt_pd(x, _mm_setzero_pd()));
+            }
+
+            static Pack selectNegative
+                    (Pack x, Pack a, Pack b)
+            {
+                return _mm_blendv_pd
+                        (b,
+                         a,
+                         _mm_cmplt_pd(x, _mm_setzero_pd()));
+            }
+
+            // 2^n for integral n: adding the magic number leaves n plus
+            // the exponent bias in the low bits, which are then shifted into
+            // the exponent field
+            static Pack exponentOfTwo
+                    (Pack n)
+            {
+                Pack const biased
+                        = _mm_add_pd
+                                (n,
+                                 _mm_set1_pd(4503599627370496.0 + 1023.0));
+
+                return _mm_castsi128_pd
+                        (_mm_slli_epi64(_mm_castpd_si128(biased), 52));
+            }
+        };
+
+        template <>
+        KernelTable<float> const &sse42Kernels<float>
+                ()
+        {
+            return Implementation<Sse42Operations<float>>::table();
+        }
+
+        template <>
+        KernelTable<double> const &sse42Kernels<double>
+                ()
+        {
+            return Implementation<Sse42Operations<double>>::table();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
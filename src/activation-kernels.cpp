@@ -0,0 +1,398 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "activation-kernels.hpp"
+#include "activation-kernels-implementation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////// | Namespace: ActivationKernels <
+    namespace ActivationKernels
+    {
+        ////////////////////////////////////// | Struct: GenericOperations <
+        // One scalar per pack, for CPUs or builds without SIMD kernels
+        template <typename ScalarType>
+        struct GenericOperations
+        {
+            using Scalar = ScalarType;
+            using Pack = ScalarType;
+
+            static constexpr int width = 1;
+
+            static Pack load
+                    (Scalar const *source)
+            {
+                return *source;
+            }
+
+            static void store
+                    (Scalar *target, Pack a)
+            {
+                *target = a;
+            }
+
+            static Pack broadcast
+                    (Scalar a)
+            {
+                return a;
+            }
+
+            static Pack add
+                    (Pack a, Pack b)
+            {
+                return a + b;
+            }
+
+            static Pack subtract
+                    (Pack a, Pack b)
+            {
+                return a - b;
+            }
+
+            static Pack multiply
+                    (Pack a, Pack b)
+            {
+                return a * b;
+            }
+
+            static Pack divide
+                    (Pack a, Pack b)
+            {
+                return a / b;
+            }
+
+            static Pack multiplyAdd
+                    (Pack a, Pack b, Pack c)
+            {
+                return a * b + c;
+            }
+
+            static Pack minimum
+                    (Pack a, Pack b)
+            {
+                return a < b ? a : b;
+            }
+
+            static Pack maximum
+                    (Pack a, Pack b)
+            {
+                return a > b ? a : b;
+            }
+
+            static Pack round
+                    (Pack a)
+            {
+                return std::nearbyint(a);
+            }
+
+            static Pack selectPositive
+                    (Pack x, Pack a, Pack b)
+            {
+                return x > 0 ? a : b;
+            }
+
+            static Pack selectNegative
+                    (Pack x, Pack a, Pack b)
+            {
+                return x < 0 ? a : b;
+            }
+
+            // 2^n for integral n, written straight into the exponent bits
+            static Pack exponentOfTwo
+                    (Pack n)
+            {
+                using Bits = std::conditional_t<std::is_same_v<Scalar, float>,
+                                                std::int32_t,
+                                                std::int64_t>;
+
+                constexpr int mantissaBits
+                        = std::numeric_limits<Scalar>::digits - 1;
+                constexpr Bits bias
+                        = std::numeric_limits<Scalar>::max_exponent - 1;
+
+                Bits const bits = (static_cast<Bits>(n) + bias)
+                                  << mantissaBits;
+
+                Pack result;
+                std::memcpy(&result, &bits, sizeof(result));
+                return result;
+            }
+        };
+
+        template <>
+        KernelTable<float> const &genericKernels<float>
+                ()
+        {
+            return Implementation<GenericOperations<float>>::table();
+        }
+
+        template <>
+        KernelTable<double> const &genericKernels<double>
+                ()
+        {
+            return Implementation<GenericOperations<double>>::table();
+        }
+
+        //////////////////////////////////// | Namespace: HelperFunctions <
+        namespace HelperFunctions
+        {
+            InstructionSet detectInstructionSet
+                    ()
+            {
+#if defined(IAD_2A_X86_ACTIVATION_KERNELS)
+                __builtin_cpu_init();
+
+                if (__builtin_cpu_supports("avx512f"))
+                    return InstructionSet::Avx512;
+
+                if (__builtin_cpu_supports("avx2")
+                    && __builtin_cpu_supports("fma"))
+                    return InstructionSet::Avx2;
+
+                if (__builtin_cpu_supports("sse4.2"))
+                    return InstructionSet::Sse42;
+#endif
+                return InstructionSet::Generic;
+            }
+
+            std::atomic<InstructionSet> selectedInstructionSet
+                    { detectInstructionSet() };
+
+            std::atomic<double> selectedExponentialErrorBound { 0.0 };
+
+            template <typename Scalar>
+            KernelTable<Scalar> const &kernels
+                    ()
+            {
+                switch (selectedInstructionSet.load(std::memory_order_relaxed))
+                {
+#if defined(IAD_2A_X86_ACTIVATION_KERNELS)
+                    case InstructionSet::Avx512:
+                        return avx512Kernels<Scalar>();
+
+                    case InstructionSet::Avx2:
+                        return avx2Kernels<Scalar>();
+
+                    case InstructionSet::Sse42:
+                        return sse42Kernels<Scalar>();
+#endif
+                    default:
+                        return genericKernels<Scalar>();
+                }
+            }
+
+            // Lowest degree whose Taylor remainder bound for e^r, relative
+            // to e^r with |r| <= ln 2 / 2, meets the error bound
+            template <typename Scalar>
+            int calculateExponentialDegree
+                    (double const relativeErrorBound)
+            {
+                double const errorBound
+                        = std::max(relativeErrorBound,
+                                   std::numeric_limits<Scalar>::epsilon()
+                                   / 2.0);
+
+                double const r = std::log(2.0) / 2.0;
+                double remainder = r * std::exp(2.0 * r);
+
+                for (int degree = 1;
+                     degree < ScalarConstants<Scalar>::maximumDegree;
+                     ++degree)
+                {
+                    remainder *= r / (degree + 1);
+
+                    if (remainder <= errorBound)
+                        return degree;
+                }
+
+                return ScalarConstants<Scalar>::maximumDegree;
+            }
+
+            // Degrees for the selected error bound, calculated when it is
+            // set rather than on every call of a kernel
+            std::atomic<int> selectedFloatExponentialDegree
+                    { calculateExponentialDegree<float>(0.0) };
+
+            std::atomic<int> selectedDoubleExponentialDegree
+                    { calculateExponentialDegree<double>(0.0) };
+
+            template <typename Scalar>
+            int exponentialDegree
+                    ()
+            {
+                if constexpr (std::is_same_v<Scalar, float>)
+                    return selectedFloatExponentialDegree.load
+                            (std::memory_order_relaxed);
+                else
+                    return selectedDoubleExponentialDegree.load
+                            (std::memory_order_relaxed);
+            }
+        }
+
+        //=================================================== | Behaviour <<
+        //---------------------------------------------------- | Dispatch <<<
+        InstructionSet instructionSet
+                ()
+        {
+            return HelperFunctions::selectedInstructionSet.load();
+        }
+
+        bool setInstructionSet
+                (InstructionSet const instructionSet)
+        {
+            if (!isSupported(instructionSet))
+                return false;
+
+            HelperFunctions::selectedInstructionSet.store(instructionSet);
+            return true;
+        }
+
+        bool isSupported
+                (InstructionSet const instructionSet)
+        {
+            return instructionSet <= HelperFunctions::detectInstructionSet();
+        }
+
+        //------------------------------------------------- | Exponential <<<
+        void setExponentialErrorBound
+                (double const relativeErrorBound)
+        {
+            HelperFunctions::selectedExponentialErrorBound
+                    .store(relativeErrorBound);
+            HelperFunctions::selectedFloatExponentialDegree
+                    .store(HelperFunctions::calculateExponentialDegree<float>
+                                   (relativeErrorBound));
+            HelperFunctions::selectedDoubleExponentialDegree
+                    .store(HelperFunctions::calculateExponentialDegree<double>
+                                   (relativeErrorBound));
+        }
+
+        double exponentialErrorBound
+                ()
+        {
+            return HelperFunctions::selectedExponentialErrorBound.load();
+        }
+
+        //----------------------------------------------------- | Kernels <<<
+        template <typename Scalar>
+        void sigmoid
+                (Scalar const *inputs,
+                 Scalar *outputs,
+                 Scalar *derivatives,
+                 std::ptrdiff_t const size)
+        {
+            HelperFunctions::kernels<Scalar>().sigmoid
+                    (inputs, outputs, derivatives, size,
+                     HelperFunctions::exponentialDegree<Scalar>());
+        }
+
+        template <typename Scalar>
+        void rectifiedLinearUnit
+                (Scalar const *inputs,
+                 Scalar *outputs,
+                 Scalar *derivatives,
+                 std::ptrdiff_t const size)
+        {
+            HelperFunctions::kernels<Scalar>().rectifiedLinearUnit
+                    (inputs, outputs, derivatives, size);
+        }
+
+        template <typename Scalar>
+        void parametricRectifiedLinearUnit
+                (Scalar const *inputs,
+                 Scalar *outputs,
+                 Scalar *derivatives,
+                 std::ptrdiff_t const size,
+                 Scalar const parameter)
+        {
+            HelperFunctions::kernels<Scalar>().parametricRectifiedLinearUnit
+                    (inputs, outputs, derivatives, size, parameter);
+        }
+
+        template <typename Scalar>
+        void identity
+                (Scalar const *inputs,
+                 Scalar *outputs,
+                 Scalar *derivatives,
+                 std::ptrdiff_t const size)
+        {
+            HelperFunctions::kernels<Scalar>().identity
+                    (inputs, outputs, derivatives, size);
+        }
+
+        template <typename Scalar>
+        void squaredDistances
+                (Scalar const *points,
+                 std::ptrdiff_t const numberOfDimensions,
+                 std::ptrdiff_t const numberOfPoints,
+                 Scalar const *query,
+                 Scalar *squaredDistances)
+        {
+            HelperFunctions::kernels<Scalar>().squaredDistances
+                    (points, numberOfDimensions, numberOfPoints, query,
+                     squaredDistances);
+        }
+
+        template <typename Scalar>
+        void boundedSquaredDistances
+                (Scalar const *points,
+                 std::ptrdiff_t const numberOfDimensions,
+                 std::ptrdiff_t const numberOfPoints,
+                 Scalar const *query,
+                 int const *segments,
+                 std::ptrdiff_t const numberOfSegments,
+                 std::ptrdiff_t const segmentSize,
+                 Scalar const bound,
+                 Scalar *squaredDistances)
+        {
+            HelperFunctions::kernels<Scalar>().boundedSquaredDistances
+                    (points, numberOfDimensions, numberOfPoints, query,
+                     segments, numberOfSegments, segmentSize, bound,
+                     squaredDistances);
+        }
+
+        //====================================== | Explicit instantiation <<
+        template void sigmoid<float>
+                (float const *, float *, float *, std::ptrdiff_t);
+        template void sigmoid<double>
+                (double const *, double *, double *, std::ptrdiff_t);
+
+        template void rectifiedLinearUnit<float>
+                (float const *, float *, float *, std::ptrdiff_t);
+        template void rectifiedLinearUnit<double>
+                (double const *, double *, double *, std::ptrdiff_t);
+
+        template void parametricRectifiedLinearUnit<float>
+                (float const *, float *, float *, std::ptrdiff_t, float);
+        template void parametricRectifiedLinearUnit<double>
+                (double const *, double *, double *, std::ptrdiff_t, double);
+
+        template void identity<float>
+                (float const *, float *, float *, std::ptrdiff_t);
+        template void identity<double>
+                (double const *, double *, double *, std::ptrdiff_t);
+
+        template void squaredDistances<float>
+                (float const *, std::ptrdiff_t, std::ptrdiff_t, float const *,
+                 float *);
+        template void squaredDistances<double>
+                (double const *, std::ptrdiff_t, std::ptrdiff_t, double const *,
+                 double *);
+
+        template void boundedSquaredDistances<float>
+                (float const *, std::ptrdiff_t, std::ptrdiff_t, float const *,
+                 int const *, std::ptrdiff_t, std::ptrdiff_t, float, float *);
+        template void boundedSquaredDistances<double>
+                (double const *, std::ptrdiff_t, std::ptrdiff_t, double const *,
+                 int const *, std::ptrdiff_t, std::ptrdiff_t, double, double *);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,148 @@
+#ifndef IAD_2A_ACTIVATION_KERNELS_HPP
+#define IAD_2A_ACTIVATION_KERNELS_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include <Eigen/Eigen>
+#include <cstddef>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////// | Namespace: ActivationKernels <
+    // Explicitly vectorised activation functions over contiguous buffers,
+    // and the squared distances of nearest neighbours search. Every kernel
+    // is compiled once per instruction set and the best one supported by
+    // the CPU is selected at startup.
+    namespace ActivationKernels
+    {
+        //======================================================= | Enums <<
+        enum class InstructionSet
+        {
+            Generic,
+            Sse42,
+            Avx2,
+            Avx512
+        };
+
+        //=================================================== | Behaviour <<
+        //---------------------------------------------------- | Dispatch <<<
+        InstructionSet instructionSet
+                ();
+
+        // Returns false, keeping the current selection, if the CPU or the
+        // build does not support the instruction set
+        bool setInstructionSet
+                (InstructionSet instructionSet);
+
+        bool isSupported
+                (InstructionSet instructionSet);
+
+        //------------------------------------------------- | Exponential <<<
+        // Maximum relative error of the exponential in sigmoid. Larger bounds
+        // select shorter polynomials; 0 means as accurate as the scalar type.
+        void setExponentialErrorBound
+                (double relativeErrorBound);
+
+        double exponentialErrorBound
+                ();
+
+        //----------------------------------------------------- | Kernels <<<
+        // Outputs or derivatives may be null when they are not needed
+        template <typename Scalar>
+        void sigmoid
+                (Scalar const *inputs,
+                 Scalar *outputs,
+                 Scalar *derivatives,
+                 std::ptrdiff_t size);
+
+        template <typename Scalar>
+        void rectifiedLinearUnit
+                (Scalar const *inputs,
+                 Scalar *outputs,
+                 Scalar *derivatives,
+                 std::ptrdiff_t size);
+
+        template <typename Scalar>
+        void parametricRectifiedLinearUnit
+                (Scalar const *inputs,
+                 Scalar *outputs,
+                 Scalar *derivatives,
+                 std::ptrdiff_t size,
+                 Scalar parameter);
+
+        template <typename Scalar>
+        void identity
+                (Scalar const *inputs,
+                 Scalar *outputs,
+                 Scalar *derivatives,
+                 std::ptrdiff_t size);
+
+        // Squared Euclidean distances from the query to points stored one
+        // after another, numberOfDimensions scalars each
+        template <typename Scalar>
+        void squaredDistances
+                (Scalar const *points,
+                 std::ptrdiff_t numberOfDimensions,
+                 std::ptrdiff_t numberOfPoints,
+                 Scalar const *query,
+                 Scalar *squaredDistances);
+
+        // Squared distances summed over segments of segmentSize dimensions,
+        // taken in the order of the segment indices given, then over the
+        // dimensions after the last whole segment. A point is abandoned
+        // once its partial sum reaches the bound, which it gets instead of
+        // its distance, so that ordering segments by decreasing spread
+        // skips most of the arithmetic of far points.
+        template <typename Scalar>
+        void boundedSquaredDistances
+                (Scalar const *points,
+                 std::ptrdiff_t numberOfDimensions,
+                 std::ptrdiff_t numberOfPoints,
+                 Scalar const *query,
+                 int const *segments,
+                 std::ptrdiff_t numberOfSegments,
+                 std::ptrdiff_t segmentSize,
+                 Scalar bound,
+                 Scalar *squaredDistances);
+
+        //------------------------------------------------------ | Arrays <<<
+        // Runs the kernel once on the whole arrays when they are contiguous,
+        // which they are for whole matrices and their leftmost columns, and
+        // once per column otherwise
+        template <typename Scalar, typename Kernel>
+        void apply
+                (Kernel const &kernel,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> *outputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> *derivatives)
+        {
+            auto const isContiguous
+                    = [](auto const &array)
+                      {
+                          return array.outerStride() == array.rows()
+                                 || array.cols() == 1;
+                      };
+
+            if (isContiguous(inputs)
+                && (outputs == nullptr || isContiguous(*outputs))
+                && (derivatives == nullptr || isContiguous(*derivatives)))
+            {
+                kernel(inputs.data(),
+                       outputs ? outputs->data() : nullptr,
+                       derivatives ? derivatives->data() : nullptr,
+                       inputs.size());
+                return;
+            }
+
+            for (Eigen::Index column = 0;
+                 column < inputs.cols();
+                 ++column)
+                kernel(inputs.col(column).data(),
+                       outputs ? outputs->col(column).data() : nullptr,
+                       derivatives ? derivatives->col(column).data() : nullptr,
+                       inputs.rows());
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif //IAD_2A_ACTIVATION_KERNELS_HPP
@@ -0,0 +1,127 @@
+#ifndef IAD_2A_AFFINE_LAYER_STEPS_HPP
+#define IAD_2A_AFFINE_LAYER_STEPS_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include <Eigen/Eigen>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    //////////////////////////////////////////////// | Class: AffineLayerSteps <
+    // Training arithmetic of affine layers, working on references to the
+    // parameters and steps a layer holds. Dynamic, variant and static affine
+    // layers all train through it, whatever sizes their matrices have, so
+    // they take identical steps.
+    template <typename Weights, typename Biases>
+    class AffineLayerSteps final
+    {
+    public:
+        //=========================================================== | Types <<
+        using Scalar = typename Weights::Scalar;
+
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        AffineLayerSteps
+                (Weights &weights,
+                 Weights &deltaWeights,
+                 Weights &momentumWeights,
+                 Biases &biases,
+                 Biases &deltaBiases,
+                 Biases &momentumBiases,
+                 int &currentNumberOfSteps,
+                 bool const isBiasEnabled)
+                :
+                weights { weights },
+                deltaWeights { deltaWeights },
+                momentumWeights { momentumWeights },
+                biases { biases },
+                deltaBiases { deltaBiases },
+                momentumBiases { momentumBiases },
+                currentNumberOfSteps { currentNumberOfSteps },
+                isBiasEnabled { isBiasEnabled }
+        {
+        }
+
+        //----------------------------------------------------------- | Main <<<
+        // Accumulates the steps of the examples in the columns
+        template <typename Inputs, typename WeightedErrors>
+        void calculateNextStep
+                (Eigen::MatrixBase<Inputs> const &inputs,
+                 Eigen::MatrixBase<WeightedErrors> const &weightedErrors) const
+        {
+            // Sum of rank-1 updates over the batch as a single matrix product
+            deltaWeights.noalias() += weightedErrors * inputs.transpose();
+
+            if (isBiasEnabled)
+                deltaBiases.noalias() += weightedErrors.rowwise().sum();
+
+            currentNumberOfSteps += static_cast<int>(inputs.cols());
+        }
+
+        // Momentum step from the average of the accumulated steps
+        void calculateMomentumStep
+                (double const learningCoefficient,
+                 double const momentumCoefficient) const
+        {
+            auto const stepCoefficient
+                    = static_cast<Scalar>(learningCoefficient
+                                          / currentNumberOfSteps);
+
+            momentumWeights
+                    = static_cast<Scalar>(momentumCoefficient)
+                      * momentumWeights
+                      + stepCoefficient * deltaWeights;
+
+            if (isBiasEnabled)
+                momentumBiases
+                        = static_cast<Scalar>(momentumCoefficient)
+                          * momentumBiases
+                          + stepCoefficient * deltaBiases;
+        }
+
+        // Parameters are the layer's own or those of another layer of the
+        // same shape, trained asynchronously
+        void applyMomentumStepTo
+                (Weights &weights,
+                 Biases &biases) const
+        {
+            weights.noalias() += momentumWeights;
+
+            if (isBiasEnabled)
+                biases.noalias() += momentumBiases;
+        }
+
+        void resetSteps
+                () const
+        {
+            currentNumberOfSteps = 0;
+
+            deltaWeights.setZero();
+            momentumWeights.setZero();
+
+            if (isBiasEnabled)
+            {
+                deltaBiases.setZero();
+                momentumBiases.setZero();
+            }
+        }
+
+        void update
+                (double const learningCoefficient,
+                 double const momentumCoefficient) const
+        {
+            calculateMomentumStep(learningCoefficient, momentumCoefficient);
+            applyMomentumStepTo(weights, biases);
+            resetSteps();
+        }
+
+    private:
+        //============================================================ | Data <<
+        Weights &weights, &deltaWeights, &momentumWeights;
+        Biases &biases, &deltaBiases, &momentumBiases;
+        int &currentNumberOfSteps;
+        bool isBiasEnabled;
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif //IAD_2A_AFFINE_LAYER_STEPS_HPP
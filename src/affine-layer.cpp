@@ -12,47 +12,64 @@
 #include <utility>
 
 /////////////////////////////////////////////////////////// | Using declarations
-using Array = Eigen::ArrayXd;
-using Matrix = Eigen::MatrixXd;
-using Vector = Eigen::VectorXd;
+template <typename Scalar>
+using Array = Eigen::ArrayX<Scalar>;
+
+template <typename Scalar>
+using Matrix = Eigen::MatrixX<Scalar>;
+
+template <typename Scalar>
+using Vector = Eigen::VectorX<Scalar>;
+
+template <typename Scalar>
+using MatrixReference = Eigen::Ref<Eigen::MatrixX<Scalar> const>;
+
+template <typename Scalar>
+using MatrixMutableReference = Eigen::Ref<Eigen::MatrixX<Scalar>>;
 
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    ///////////////////////////////////////////////////// | Class: AffineLayer <
+    //////////////////////////////////////////////// | Class: BasicAffineLayer <
     //============================================================= | Methods <<
     //----------------------------------------------------- | Static methods <<<
-    void AffineLayer::initialiseRandomNumberGenerator
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::initialiseRandomNumberGenerator
             (int const seed)
     {
         srand(static_cast<unsigned int>(seed));
     }
 
     //------------------------------------------------------- | Constructors <<<
-    AffineLayer::AffineLayer
+    template <typename Scalar>
+    BasicAffineLayer<Scalar>::BasicAffineLayer
             ()
             :
-            AffineLayer(1, 1, Sigmoid {}, true)
+            BasicAffineLayer(1, 1, BasicSigmoid<Scalar> {}, true)
     {
     }
 
-    AffineLayer::AffineLayer
+    template <typename Scalar>
+    BasicAffineLayer<Scalar>::BasicAffineLayer
             (int const numberOfInputs,
              int const numberOfOutputs,
-             ActivationFunction const &activationFunction,
+             BasicActivationFunction<Scalar> const &activationFunction,
              bool const enableBias)
             :
-            NeuralNetworkLayer {},
+            BasicNeuralNetworkLayer<Scalar> {},
 
             weights { std::sqrt(2.0 / (numberOfInputs + numberOfOutputs))
-                      * Matrix::Random(numberOfOutputs, numberOfInputs) },
-            deltaWeights { Matrix::Zero(numberOfOutputs, numberOfInputs) },
-            momentumWeights { Matrix::Zero(numberOfOutputs, numberOfInputs) },
+                      * Matrix<Scalar>::Random(numberOfOutputs,
+                                               numberOfInputs) },
+            deltaWeights { Matrix<Scalar>::Zero(numberOfOutputs,
+                                                numberOfInputs) },
+            momentumWeights { Matrix<Scalar>::Zero(numberOfOutputs,
+                                                   numberOfInputs) },
 
             biases { std::sqrt(2.0 / (numberOfInputs + numberOfOutputs))
-                     * Vector::Random(numberOfOutputs) },
-            deltaBiases { Vector::Zero(numberOfOutputs) },
-            momentumBiases { Vector::Zero(numberOfOutputs) },
+                     * Vector<Scalar>::Random(numberOfOutputs) },
+            deltaBiases { Vector<Scalar>::Zero(numberOfOutputs) },
+            momentumBiases { Vector<Scalar>::Zero(numberOfOutputs) },
 
             activationFunction { activationFunction.clone() },
             currentNumberOfSteps { 0 },
@@ -60,10 +77,11 @@ namespace NeuralNetworks
     {
     }
 
-    AffineLayer::AffineLayer
+    template <typename Scalar>
+    BasicAffineLayer<Scalar>::BasicAffineLayer
             (std::string const &filename)
             :
-            NeuralNetworkLayer {}
+            BasicNeuralNetworkLayer<Scalar> {}
     {
         std::ifstream file;
         file.open(filename, std::ios::binary);
@@ -74,10 +92,11 @@ namespace NeuralNetworks
         file.close();
     }
 
-    AffineLayer::AffineLayer
-            (AffineLayer const &affineLayer)
+    template <typename Scalar>
+    BasicAffineLayer<Scalar>::BasicAffineLayer
+            (BasicAffineLayer const &affineLayer)
             :
-            NeuralNetworkLayer { affineLayer },
+            BasicNeuralNetworkLayer<Scalar> { affineLayer },
 
             weights { affineLayer.weights },
             deltaWeights { affineLayer.deltaWeights },
@@ -92,83 +111,102 @@ namespace NeuralNetworks
     }
 
     //---------------------------------------------------------- | Operators <<<
-    Vector AffineLayer::operator()
-            (Vector const &inputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicAffineLayer<Scalar>::operator()
+            (Vector<Scalar> const &inputs) const
     {
         return feedForward(inputs);
     }
 
     //------------------------------ | Interface: Cloneable | Implementation <<<
-    std::unique_ptr<NeuralNetworkLayer> AffineLayer::clone
+    template <typename Scalar>
+    std::unique_ptr<BasicNeuralNetworkLayer<Scalar>>
+    BasicAffineLayer<Scalar>::clone
             () const
     {
-        return std::make_unique<AffineLayer>(*this);
+        return std::make_unique<BasicAffineLayer>(*this);
     }
 
     //----------------------------------------------------- | Main behaviour <<<
-    Vector AffineLayer::calculateOutputs
-            (Vector const &inputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicAffineLayer<Scalar>::calculateOutputs
+            (Vector<Scalar> const &inputs) const
     {
-        return weights * inputs
-               + (isBiasEnabled ? biases : Vector::Zero(biases.size()));
+        Vector<Scalar> outputs
+                { numberOfOutputs() };
+
+        calculateOutputsBatch(inputs, outputs);
+
+        return outputs;
     }
 
-    Vector AffineLayer::activate
-            (Vector const &outputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicAffineLayer<Scalar>::activate
+            (Vector<Scalar> const &outputs) const
     {
         return (*activationFunction)(outputs);
     }
 
-    Vector AffineLayer::calculateOutputsDerivative
-            (Vector const &outputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicAffineLayer<Scalar>::calculateOutputsDerivative
+            (Vector<Scalar> const &outputs) const
     {
         return activationFunction->derivative(outputs);
     }
 
-    Vector AffineLayer::feedForward
-            (Vector const &inputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicAffineLayer<Scalar>::feedForward
+            (Vector<Scalar> const &inputs) const
     {
         return activate(calculateOutputs(inputs));
     }
 
-    Vector AffineLayer::backpropagate
-            (Vector const &inputs,
-             Vector const &errors,
-             Vector const &outputs,
-             Vector const &outputsDerivative) const
+    template <typename Scalar>
+    Vector<Scalar> BasicAffineLayer<Scalar>::backpropagate
+            (Vector<Scalar> const &inputs,
+             Vector<Scalar> const &errors,
+             Vector<Scalar> const &outputs,
+             Vector<Scalar> const &outputsDerivative) const
     {
-        return weights.transpose()
-               * (errors.array() * outputsDerivative.array()).matrix();
-    }
+        Vector<Scalar> const weightedErrors
+                = errors.array() * outputsDerivative.array();
 
-    void AffineLayer::calculateNextStep
-            (Vector const &inputs,
-             Vector const &errors,
-             Vector const &outputs,
-             Vector const &outputsDerivative)
-    {
-        Vector derivative = -errors.array()
-                            * outputsDerivative.array();
+        Vector<Scalar> backpropagatedErrors
+                { numberOfInputs() };
 
-        deltaWeights.noalias() -= derivative * inputs.transpose();
+        backpropagateBatch(inputs,
+                           weightedErrors,
+                           outputs,
+                           backpropagatedErrors);
 
-        if (isBiasEnabled)
-            deltaBiases.noalias() -= derivative;
+        return backpropagatedErrors;
+    }
 
-        ++currentNumberOfSteps;
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::calculateNextStep
+            (Vector<Scalar> const &inputs,
+             Vector<Scalar> const &errors,
+             Vector<Scalar> const &outputs,
+             Vector<Scalar> const &outputsDerivative)
+    {
+        Vector<Scalar> const weightedErrors
+                = errors.array() * outputsDerivative.array();
+
+        calculateNextStepBatch(inputs,
+                               weightedErrors,
+                               outputs);
     }
 
-    void AffineLayer::update
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::update
             (double const learningCoefficient,
              double const momentumCoefficient)
     {
-        applyAverageOfDeltaStepsToMomentumStep(learningCoefficient,
-                                               momentumCoefficient);
-        applyMomentumStepToWeightsAndBiases();
-        resetStepData();
+        steps().update(learningCoefficient, momentumCoefficient);
     }
 
-    void AffineLayer::saveToFile
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::saveToFile
             (std::string const &filename) const
     {
         std::ofstream file;
@@ -180,156 +218,280 @@ namespace NeuralNetworks
         file.close();
     }
 
-    //------------------------------------------------------------- | Traits <<<
-    int AffineLayer::numberOfInputs
-            () const
+    //-------------------------------------------------------------- | Batch <<<
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::calculateOutputsBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixMutableReference<Scalar> outputs) const
     {
-        return weights.cols();
+        outputs.noalias() = weights * inputs;
+
+        if (isBiasEnabled)
+            outputs.colwise() += biases;
     }
 
-    int AffineLayer::numberOfOutputs
-            () const
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::activateBatch
+            (MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> activatedOutputs) const
     {
-        return weights.rows();
+        activationFunction->activateBatch(outputs.array(),
+                                          activatedOutputs.array());
     }
 
-    //--------------------------------------------------- | Helper functions <<<
-    void AffineLayer::applyAverageOfDeltaStepsToMomentumStep
-            (double const learningCoefficient,
-             double const momentumCoefficient)
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::calculateOutputsDerivativeBatch
+            (MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> outputsDerivative) const
     {
-//        (momentumWeights *= momentumCoefficient)
-//                += (learningCoefficient
-//                    * (deltaWeights / currentNumberOfSteps));
+        activationFunction->derivativeBatch(outputs.array(),
+                                            outputsDerivative.array());
+    }
 
-        momentumWeights.noalias()
-                = momentumCoefficient * momentumWeights
-                  + (learningCoefficient / currentNumberOfSteps)
-                    * deltaWeights;
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::activateWithDerivativeBatch
+            (MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> activatedOutputs,
+             MatrixMutableReference<Scalar> outputsDerivative) const
+    {
+        activationFunction->activateWithDerivativeBatch
+                (outputs.array(),
+                 activatedOutputs.array(),
+                 outputsDerivative.array());
+    }
 
-//        if (isBiasEnabled)
-//            (momentumBiases *= momentumCoefficient)
-//                    += (learningCoefficient
-//                        * (deltaBiases / currentNumberOfSteps));
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::backpropagateBatch
+            (MatrixReference<Scalar> const &/*inputs*/,
+             MatrixReference<Scalar> const &weightedErrors,
+             MatrixReference<Scalar> const &/*outputs*/,
+             MatrixMutableReference<Scalar> backpropagatedErrors) const
+    {
+        backpropagatedErrors.noalias() = weights.transpose() * weightedErrors;
+    }
 
-        if (isBiasEnabled)
-            momentumBiases.noalias()
-                    = momentumCoefficient * momentumBiases
-                      + (learningCoefficient / currentNumberOfSteps)
-                        * deltaBiases;
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::calculateNextStepBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixReference<Scalar> const &weightedErrors,
+             MatrixReference<Scalar> const &/*outputs*/)
+    {
+        steps().calculateNextStep(inputs, weightedErrors);
     }
 
-    void AffineLayer::applyMomentumStepToWeightsAndBiases
-            ()
+    //-------------------------------------------------- | Parallel training <<<
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::synchroniseParameters
+            (BasicNeuralNetworkLayer<Scalar> const &layer)
     {
-        weights.noalias() += momentumWeights;
+        auto const &other = dynamic_cast<BasicAffineLayer const &>(layer);
+
+        weights = other.weights;
 
         if (isBiasEnabled)
-            biases.noalias() += momentumBiases;
+            biases = other.biases;
     }
 
-    void AffineLayer::resetStepData
-            ()
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::accumulateSteps
+            (BasicNeuralNetworkLayer<Scalar> &layer)
     {
-        currentNumberOfSteps = 0;
+        auto &other = dynamic_cast<BasicAffineLayer &>(layer);
 
-        deltaWeights.setZero();
-        momentumWeights.setZero();
+        deltaWeights.noalias() += other.deltaWeights;
+        other.deltaWeights.setZero();
 
         if (isBiasEnabled)
         {
-            deltaBiases.setZero();
-            momentumBiases.setZero();
+            deltaBiases.noalias() += other.deltaBiases;
+            other.deltaBiases.setZero();
         }
+
+        currentNumberOfSteps += other.currentNumberOfSteps;
+        other.currentNumberOfSteps = 0;
     }
 
-    ///////////////////////////////////////////// | Class: AffineLayerWithBias <
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::applyStepsTo
+            (BasicNeuralNetworkLayer<Scalar> &layer,
+             double const learningCoefficient,
+             double const momentumCoefficient)
+    {
+        auto &other = dynamic_cast<BasicAffineLayer &>(layer);
+
+        auto const layerSteps = steps();
+
+        layerSteps.calculateMomentumStep(learningCoefficient,
+                                         momentumCoefficient);
+
+        // Hogwild: other threads may read or write these concurrently
+        layerSteps.applyMomentumStepTo(other.weights, other.biases);
+        layerSteps.resetSteps();
+    }
+
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::beginAsynchronousSteps
+            ()
+    {
+    }
+
+    template <typename Scalar>
+    void BasicAffineLayer<Scalar>::endAsynchronousSteps
+            ()
+    {
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    template <typename Scalar>
+    int BasicAffineLayer<Scalar>::numberOfInputs
+            () const
+    {
+        return weights.cols();
+    }
+
+    template <typename Scalar>
+    int BasicAffineLayer<Scalar>::numberOfOutputs
+            () const
+    {
+        return weights.rows();
+    }
+
+    template <typename Scalar>
+    bool BasicAffineLayer<Scalar>::hasBiases
+            () const
+    {
+        return isBiasEnabled;
+    }
+
+    template <typename Scalar>
+    BasicActivationFunction<Scalar> const &
+    BasicAffineLayer<Scalar>::getActivationFunction
+            () const
+    {
+        return *activationFunction;
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    template <typename Scalar>
+    AffineLayerSteps<Matrix<Scalar>, Vector<Scalar>>
+    BasicAffineLayer<Scalar>::steps
+            ()
+    {
+        return { weights,
+                 deltaWeights,
+                 momentumWeights,
+                 biases,
+                 deltaBiases,
+                 momentumBiases,
+                 currentNumberOfSteps,
+                 isBiasEnabled };
+    }
+
+    //////////////////////////////////////// | Class: BasicAffineLayerWithBias <
     //============================================================= | Methods <<
     //------------------------------------------------------- | Constructors <<<
-    AffineLayerWithBias::AffineLayerWithBias
+    template <typename Scalar>
+    BasicAffineLayerWithBias<Scalar>::BasicAffineLayerWithBias
             ()
             :
-            AffineLayerWithBias(1, 1, Sigmoid {})
+            BasicAffineLayerWithBias(1, 1, BasicSigmoid<Scalar> {})
     {
     }
 
-    AffineLayerWithBias::AffineLayerWithBias
+    template <typename Scalar>
+    BasicAffineLayerWithBias<Scalar>::BasicAffineLayerWithBias
             (int const numberOfInputs,
              int const numberOfOutputs,
-             ActivationFunction const &activationFunction)
+             BasicActivationFunction<Scalar> const &activationFunction)
             :
-            AffineLayer { numberOfInputs,
+            BasicAffineLayer<Scalar> { numberOfInputs,
                           numberOfOutputs,
                           activationFunction,
                           true }
     {
     }
 
-    AffineLayerWithBias::AffineLayerWithBias
+    template <typename Scalar>
+    BasicAffineLayerWithBias<Scalar>::BasicAffineLayerWithBias
             (std::string const &filename)
             :
-            AffineLayer { filename }
+            BasicAffineLayer<Scalar> { filename }
     {
     }
 
-    AffineLayerWithBias::AffineLayerWithBias
-            (AffineLayerWithBias const &affineLayerWithBias)
+    template <typename Scalar>
+    BasicAffineLayerWithBias<Scalar>::BasicAffineLayerWithBias
+            (BasicAffineLayerWithBias const &affineLayerWithBias)
             :
-            AffineLayer { affineLayerWithBias }
+            BasicAffineLayer<Scalar> { affineLayerWithBias }
     {
     }
 
     //------------------------------ | Interface: Cloneable | Implementation <<<
-    std::unique_ptr<NeuralNetworkLayer> AffineLayerWithBias::clone
+    template <typename Scalar>
+    std::unique_ptr<BasicNeuralNetworkLayer<Scalar>>
+    BasicAffineLayerWithBias<Scalar>::clone
             () const
     {
-        return std::make_unique<AffineLayerWithBias>(*this);
+        return std::make_unique<BasicAffineLayerWithBias>(*this);
     }
 
-    ////////////////////////////////////////// | Class: AffineLayerWithoutBias <
+    ///////////////////////////////////// | Class: BasicAffineLayerWithoutBias <
     //============================================================= | Methods <<
     //------------------------------------------------------- | Constructors <<<
-    AffineLayerWithoutBias::AffineLayerWithoutBias
+    template <typename Scalar>
+    BasicAffineLayerWithoutBias<Scalar>::BasicAffineLayerWithoutBias
             ()
             :
-            AffineLayerWithoutBias(1, 1, Sigmoid {})
+            BasicAffineLayerWithoutBias(1, 1, BasicSigmoid<Scalar> {})
     {
     }
 
-    AffineLayerWithoutBias::AffineLayerWithoutBias
+    template <typename Scalar>
+    BasicAffineLayerWithoutBias<Scalar>::BasicAffineLayerWithoutBias
             (int const numberOfInputs,
              int const numberOfOutputs,
-             ActivationFunction const &activationFunction)
+             BasicActivationFunction<Scalar> const &activationFunction)
             :
-            AffineLayer { numberOfInputs,
+            BasicAffineLayer<Scalar> { numberOfInputs,
                           numberOfOutputs,
                           activationFunction,
                           false }
     {
     }
 
-    AffineLayerWithoutBias::AffineLayerWithoutBias
+    template <typename Scalar>
+    BasicAffineLayerWithoutBias<Scalar>::BasicAffineLayerWithoutBias
             (std::string const &filename)
             :
-            AffineLayer { filename }
+            BasicAffineLayer<Scalar> { filename }
     {
     }
 
-    AffineLayerWithoutBias::AffineLayerWithoutBias
-            (AffineLayerWithoutBias const &affineLayerWithBias)
+    template <typename Scalar>
+    BasicAffineLayerWithoutBias<Scalar>::BasicAffineLayerWithoutBias
+            (BasicAffineLayerWithoutBias const &affineLayerWithBias)
             :
-            AffineLayer { affineLayerWithBias }
+            BasicAffineLayer<Scalar> { affineLayerWithBias }
     {
     }
 
     //------------------------------ | Interface: Cloneable | Implementation <<<
-    std::unique_ptr<NeuralNetworkLayer> AffineLayerWithoutBias::clone
+    template <typename Scalar>
+    std::unique_ptr<BasicNeuralNetworkLayer<Scalar>>
+    BasicAffineLayerWithoutBias<Scalar>::clone
             () const
     {
-        return std::make_unique<AffineLayerWithoutBias>(*this);
+        return std::make_unique<BasicAffineLayerWithoutBias>(*this);
     }
 
-
+    //============================================== | Explicit instantiation <<
+    template class BasicAffineLayer<float>;
+    template class BasicAffineLayer<double>;
+    template class BasicAffineLayerWithBias<float>;
+    template class BasicAffineLayerWithBias<double>;
+    template class BasicAffineLayerWithoutBias<float>;
+    template class BasicAffineLayerWithoutBias<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
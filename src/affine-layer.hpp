@@ -2,6 +2,7 @@
 #define IAD_2A_AFFINE_LAYER_HPP
 ///////////////////////////////////////////////////////////////////// | Includes
 #include "activation-function.hpp"
+#include "affine-layer-steps.hpp"
 #include "sigmoid.hpp"
 #include "rectified-linear-unit.hpp"
 #include "training-example.hpp"
@@ -21,20 +22,25 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    ///////////////////////////////////////////////////// | Class: AffineLayer <
-    class AffineLayer
-            : public NeuralNetworkLayer
+    //////////////////////////////////////////////// | Class: BasicAffineLayer <
+    template <typename Scalar>
+    class BasicAffineLayer
+            : public BasicNeuralNetworkLayer<Scalar>
     {
     public:
-        Eigen::VectorXd getBiases()
+        Eigen::VectorX<Scalar> getBiases() const
         {
             return biases;
         }
-        void setWeights(Eigen::MatrixXd const &w)
+        void setWeights(Eigen::MatrixX<Scalar> const &w)
         {
             weights = w;
         }
-        Eigen::MatrixXd getWeights()
+        void setBiases(Eigen::VectorX<Scalar> const &b)
+        {
+            biases = b;
+        }
+        Eigen::MatrixX<Scalar> getWeights() const
         {
             return weights;
         }
@@ -44,49 +50,50 @@ namespace NeuralNetworks
                 (int seed);
 
         //--------------------------------------------------- | Constructors <<<
-        AffineLayer
+        BasicAffineLayer
                 ();
 
-        explicit AffineLayer
+        explicit BasicAffineLayer
                 (int numberOfInputs,
                  int numberOfOutputs,
-                 ActivationFunction const &activationFunction,
+                 BasicActivationFunction<Scalar> const &activationFunction,
                  bool enableBias);
 
-        explicit AffineLayer
+        explicit BasicAffineLayer
                 (std::string const &filename);
 
-        AffineLayer
-                (AffineLayer const &);
+        BasicAffineLayer
+                (BasicAffineLayer const &);
 
         //------------------------------------------------------ | Operators <<<
-        Eigen::VectorXd operator()
-                (Eigen::VectorXd const &inputs) const override;
+        Eigen::VectorX<Scalar> operator()
+                (Eigen::VectorX<Scalar> const &inputs) const override;
 
         //------------------------------------------------- | Main behaviour <<<
-        Eigen::VectorXd calculateOutputs
-                (Eigen::VectorXd const &inputs) const override;
+        Eigen::VectorX<Scalar> calculateOutputs
+                (Eigen::VectorX<Scalar> const &inputs) const override;
 
-        Eigen::VectorXd activate
-                (Eigen::VectorXd const &outputs) const override;
+        Eigen::VectorX<Scalar> activate
+                (Eigen::VectorX<Scalar> const &outputs) const override;
 
-        Eigen::VectorXd calculateOutputsDerivative
-                (Eigen::VectorXd const &outputs) const override;
+        Eigen::VectorX<Scalar> calculateOutputsDerivative
+                (Eigen::VectorX<Scalar> const &outputs) const override;
 
-        Eigen::VectorXd feedForward
-                (Eigen::VectorXd const &inputs) const override;
+        Eigen::VectorX<Scalar> feedForward
+                (Eigen::VectorX<Scalar> const &inputs) const override;
 
-        Eigen::VectorXd backpropagate
-                (Eigen::VectorXd const &inputs,
-                 Eigen::VectorXd const &errors,
-                 Eigen::VectorXd const &outputs,
-                 Eigen::VectorXd const &outputsDerivative) const override;
+        Eigen::VectorX<Scalar> backpropagate
+                (Eigen::VectorX<Scalar> const &inputs,
+                 Eigen::VectorX<Scalar> const &errors,
+                 Eigen::VectorX<Scalar> const &outputs,
+                 Eigen::VectorX<Scalar> const &outputsDerivative)
+                const override;
 
         void calculateNextStep
-                (Eigen::VectorXd const &inputs,
-                 Eigen::VectorXd const &errors,
-                 Eigen::VectorXd const &outputs,
-                 Eigen::VectorXd const &outputsDerivative) override;
+                (Eigen::VectorX<Scalar> const &inputs,
+                 Eigen::VectorX<Scalar> const &errors,
+                 Eigen::VectorX<Scalar> const &outputs,
+                 Eigen::VectorX<Scalar> const &outputsDerivative) override;
 
         void update
                 (double learningCoefficient,
@@ -95,6 +102,58 @@ namespace NeuralNetworks
         void saveToFile
                 (std::string const &filename) const override;
 
+        //---------------------------------------------------------- | Batch <<<
+        void calculateOutputsBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputs) const override;
+
+        void activateBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> activatedOutputs)
+                const override;
+
+        void calculateOutputsDerivativeBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputsDerivative)
+                const override;
+
+        void activateWithDerivativeBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> activatedOutputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputsDerivative)
+                const override;
+
+        void backpropagateBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> backpropagatedErrors)
+                const override;
+
+        void calculateNextStepBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs)
+                override;
+
+        //---------------------------------------------- | Parallel training <<<
+        void synchroniseParameters
+                (BasicNeuralNetworkLayer<Scalar> const &layer) override;
+
+        void accumulateSteps
+                (BasicNeuralNetworkLayer<Scalar> &layer) override;
+
+        void applyStepsTo
+                (BasicNeuralNetworkLayer<Scalar> &layer,
+                 double learningCoefficient,
+                 double momentumCoefficient) override;
+
+        void beginAsynchronousSteps
+                () override;
+
+        void endAsynchronousSteps
+                () override;
+
         //--------------------------------------------------------- | Traits <<<
         int numberOfInputs
                 () const override;
@@ -102,15 +161,21 @@ namespace NeuralNetworks
         int numberOfOutputs
                 () const override;
 
+        bool hasBiases
+                () const;
+
+        BasicActivationFunction<Scalar> const &getActivationFunction
+                () const;
+
         //-------------------------- | Interface: Cloneable | Implementation <<<
-        std::unique_ptr<NeuralNetworkLayer> clone
+        std::unique_ptr<BasicNeuralNetworkLayer<Scalar>> clone
                 () const override;
 
     private:
         //============================================================ | Data <<
-        Eigen::MatrixXd weights, deltaWeights, momentumWeights;
-        Eigen::VectorXd biases, deltaBiases, momentumBiases;
-        std::unique_ptr<ActivationFunction> activationFunction;
+        Eigen::MatrixX<Scalar> weights, deltaWeights, momentumWeights;
+        Eigen::VectorX<Scalar> biases, deltaBiases, momentumBiases;
+        std::unique_ptr<BasicActivationFunction<Scalar>> activationFunction;
         int currentNumberOfSteps;
         bool isBiasEnabled;
 
@@ -141,40 +206,35 @@ namespace NeuralNetworks
         }
 
         //----------------------------------------------- | Helper functions <<<
-        void applyAverageOfDeltaStepsToMomentumStep
-                (double learningCoefficient,
-                 double momentumCoefficient);
-
-        void applyMomentumStepToWeightsAndBiases
-                ();
-
-        void resetStepData
+        AffineLayerSteps<Eigen::MatrixX<Scalar>, Eigen::VectorX<Scalar>> steps
                 ();
     };
 
-    ///////////////////////////////////////////// | Class: AffineLayerWithBias <
-    class AffineLayerWithBias
-            : public AffineLayer
+    //////////////////////////////////////// | Class: BasicAffineLayerWithBias <
+    template <typename Scalar>
+    class BasicAffineLayerWithBias
+            : public BasicAffineLayer<Scalar>
     {
     public:
         //========================================================= | Methods <<
         //--------------------------------------------------- | Constructors <<<
-        AffineLayerWithBias
+        BasicAffineLayerWithBias
                 ();
 
-        explicit AffineLayerWithBias
+        explicit BasicAffineLayerWithBias
                 (int numberOfInputs,
                  int numberOfOutputs,
-                 ActivationFunction const &activationFunction = Identity {});
+                 BasicActivationFunction<Scalar> const &activationFunction
+                 = BasicIdentity<Scalar> {});
 
-        explicit AffineLayerWithBias
+        explicit BasicAffineLayerWithBias
                 (std::string const &filename);
 
-        AffineLayerWithBias
-                (AffineLayerWithBias const &);
+        BasicAffineLayerWithBias
+                (BasicAffineLayerWithBias const &);
 
         //-------------------------- | Interface: Cloneable | Implementation <<<
-        std::unique_ptr<NeuralNetworkLayer> clone
+        std::unique_ptr<BasicNeuralNetworkLayer<Scalar>> clone
                 () const final;
 
     private:
@@ -197,29 +257,31 @@ namespace NeuralNetworks
         }
     };
 
-    ///////////////////////////////////////////// | Class: AffineLayerWithBias <
-    class AffineLayerWithoutBias
-            : public AffineLayer
+    //////////////////////////////////////// | Class: BasicAffineLayerWithBias <
+    template <typename Scalar>
+    class BasicAffineLayerWithoutBias
+            : public BasicAffineLayer<Scalar>
     {
     public:
         //========================================================= | Methods <<
         //--------------------------------------------------- | Constructors <<<
-        AffineLayerWithoutBias
+        BasicAffineLayerWithoutBias
                 ();
 
-        explicit AffineLayerWithoutBias
+        explicit BasicAffineLayerWithoutBias
                 (int numberOfInputs,
                  int numberOfOutputs,
-                 ActivationFunction const &activationFunction = Identity {});
+                 BasicActivationFunction<Scalar> const &activationFunction
+                 = BasicIdentity<Scalar> {});
 
-        explicit AffineLayerWithoutBias
+        explicit BasicAffineLayerWithoutBias
                 (std::string const &filename);
 
-        AffineLayerWithoutBias
-                (AffineLayerWithoutBias const &);
+        BasicAffineLayerWithoutBias
+                (BasicAffineLayerWithoutBias const &);
 
         //-------------------------- | Interface: Cloneable | Implementation <<<
-        std::unique_ptr<NeuralNetworkLayer> clone
+        std::unique_ptr<BasicNeuralNetworkLayer<Scalar>> clone
                 () const final;
 
     private:
@@ -241,6 +303,11 @@ namespace NeuralNetworks
             archive(*this);
         }
     };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using AffineLayer = BasicAffineLayer<double>;
+    using AffineLayerWithBias = BasicAffineLayerWithBias<double>;
+    using AffineLayerWithoutBias = BasicAffineLayerWithoutBias<double>;
 }
 
 //////////////////////////////////////// | cereal: Polymorphic type registration
@@ -261,5 +328,21 @@ CEREAL_REGISTER_POLYMORPHIC_RELATION(NeuralNetworks::AffineLayer,
 //CEREAL_REGISTER_POLYMORPHIC_RELATION(NeuralNetworks::NeuralNetworkLayer,
 //                                     NeuralNetworks::AffineLayerWithoutBias)
 
+CEREAL_REGISTER_TYPE(NeuralNetworks::BasicAffineLayer<float>)
+CEREAL_REGISTER_TYPE(NeuralNetworks::BasicAffineLayerWithBias<float>)
+CEREAL_REGISTER_TYPE(NeuralNetworks::BasicAffineLayerWithoutBias<float>)
+
+CEREAL_REGISTER_POLYMORPHIC_RELATION
+        (NeuralNetworks::BasicNeuralNetworkLayer<float>,
+         NeuralNetworks::BasicAffineLayer<float>)
+
+CEREAL_REGISTER_POLYMORPHIC_RELATION
+        (NeuralNetworks::BasicAffineLayer<float>,
+         NeuralNetworks::BasicAffineLayerWithBias<float>)
+
+CEREAL_REGISTER_POLYMORPHIC_RELATION
+        (NeuralNetworks::BasicAffineLayer<float>,
+         NeuralNetworks::BasicAffineLayerWithoutBias<float>)
+
 ////////////////////////////////////////////////////////////////////////////////
 #endif //IAD_2A_AFFINE_LAYER_HPP
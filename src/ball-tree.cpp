@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "ball-tree.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////// | Using declarations
+using Vector = Eigen::VectorXd;
+using VectorMap = Eigen::Map<Eigen::VectorXd const>;
+using MatrixReference = Eigen::Ref<Eigen::MatrixXd const>;
+using VectorReference = Eigen::Ref<Eigen::VectorXd const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    namespace
+    {
+        // Column of the point listed in indices, from begin to end, farthest
+        // from the given one
+        int findFarthest
+                (MatrixReference const &points,
+                 int const *const indices,
+                 int const begin,
+                 int const end,
+                 VectorReference const &point,
+                 double &farthestSquaredDistance)
+        {
+            int farthest = indices[begin];
+            farthestSquaredDistance = 0.0;
+
+            for (int i = begin; i < end; ++i)
+            {
+                double const squaredDistance
+                        = (points.col(indices[i]) - point).squaredNorm();
+
+                if (squaredDistance > farthestSquaredDistance)
+                {
+                    farthest = indices[i];
+                    farthestSquaredDistance = squaredDistance;
+                }
+            }
+
+            return farthest;
+        }
+    }
+
+    //////////////////////////////////////////////////////// | Class: BallTree <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    BallTree::BallTree
+            (MatrixReference const &points,
+             int const leafSize)
+            :
+            tree { static_cast<int>(points.rows()),
+                   static_cast<int>(points.cols()),
+                   leafSize }
+    {
+        ownedCentres.resize(points.rows(), tree.maximumNumberOfNodes());
+
+        tree.build([this, &points](Node &node, int const index)
+                   {
+                       int const *const order = tree.getOrder();
+
+                       Vector centre = Vector::Zero(points.rows());
+                       for (int i = node.begin; i < node.end; ++i)
+                           centre += points.col(order[i]);
+                       centre /= node.end - node.begin;
+
+                       double squaredRadius;
+                       findFarthest(points,
+                                    order,
+                                    node.begin,
+                                    node.end,
+                                    centre,
+                                    squaredRadius);
+
+                       ownedCentres.col(index) = centre;
+                       node.radius = std::sqrt(squaredRadius);
+                   },
+                   // Projections on the line between the point farthest
+                   // from the centre and the point farthest from that one
+                   [this, &points](Node const &node, int const index)
+                   {
+                       int const *const order = tree.getOrder();
+                       double squaredDistance;
+
+                       int const farthest
+                               = findFarthest(points,
+                                              order,
+                                              node.begin,
+                                              node.end,
+                                              ownedCentres.col(index),
+                                              squaredDistance);
+                       int const opposite
+                               = findFarthest(points,
+                                              order,
+                                              node.begin,
+                                              node.end,
+                                              points.col(farthest),
+                                              squaredDistance);
+
+                       Vector direction
+                               = points.col(opposite) - points.col(farthest);
+
+                       return [&points, direction](int const point)
+                       {
+                           return direction.dot(points.col(point));
+                       };
+                   });
+
+        ownedCentres.conservativeResize(Eigen::NoChange,
+                                        tree.getNumberOfNodes());
+
+        centres = ownedCentres.data();
+    }
+
+    BallTree::BallTree
+            (MappedIndexFile &file)
+            :
+            tree { file }
+    {
+        centres = tree.readBounds(file);
+    }
+
+    //--------------------------------------------------------------- | Main <<<
+    void BallTree::findNearest
+            (MatrixReference const &points,
+             VectorReference const &query,
+             NeighbourHeap &neighbours) const
+    {
+        tree.findNearest(points,
+                         query,
+                         neighbours,
+                         [this, &query](int const node)
+                         {
+                             return squaredDistanceToBall(node, query);
+                         });
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    bool BallTree::isEmpty
+            () const
+    {
+        return tree.isEmpty();
+    }
+
+    //------------------------------------------------------ | Serialization <<<
+    void BallTree::writeToFile
+            (IndexFileWriter &file) const
+    {
+        tree.writeToFile(file);
+        tree.writeBounds(file, centres);
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    double BallTree::squaredDistanceToBall
+            (int const node,
+             VectorReference const &query) const
+    {
+        int const numberOfDimensions = tree.getNumberOfDimensions();
+        VectorMap const centre
+                { centres + std::size_t(node) * numberOfDimensions,
+                  numberOfDimensions };
+
+        double const distance
+                = std::max(0.0,
+                           (centre - query).norm()
+                           - tree.getNodes()[node].radius);
+
+        return distance * distance;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,92 @@
+#ifndef IAD_2A_BALL_TREE_HPP
+#define IAD_2A_BALL_TREE_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "index-file.hpp"
+#include "neighbour-heap.hpp"
+#include "search-tree.hpp"
+
+#include <Eigen/Eigen>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    //////////////////////////////////////////////////////// | Class: BallTree <
+    // Exact nearest neighbours search for points of many dimensions, where
+    // bounding boxes stop pruning. Nodes keep a ball around their points and
+    // split them at the median of their projections on the line between two
+    // far apart points. Like KdTree, the points are passed to every query,
+    // and the arrays are owned or mapped from an index file.
+    class BallTree final
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        BallTree
+                () = default;
+
+        // One point per column
+        explicit BallTree
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 int leafSize = 32);
+
+        // Maps a tree written by writeToFile, which has to outlive it
+        explicit BallTree
+                (MappedIndexFile &file);
+
+        // Copies would point into the original's arrays
+        BallTree
+                (BallTree const &) = delete;
+
+        BallTree
+                (BallTree &&) = default;
+
+        BallTree &operator=
+                (BallTree const &) = delete;
+
+        BallTree &operator=
+                (BallTree &&) = default;
+
+        //----------------------------------------------------------- | Main <<<
+        // Pushes the nearest points into neighbours, which keeps as many of
+        // them as it was cleared for
+        void findNearest
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 Eigen::Ref<Eigen::VectorXd const> const &query,
+                 NeighbourHeap &neighbours) const;
+
+        //--------------------------------------------------------- | Traits <<<
+        bool isEmpty
+                () const;
+
+        //-------------------------------------------------- | Serialization <<<
+        void writeToFile
+                (IndexFileWriter &file) const;
+
+    private:
+        //====================================================== | Structures <<
+        struct Node
+        {
+            int begin, end;
+            int left, right;
+            double radius;
+        };
+
+        //============================================================ | Data <<
+        SearchTree<Node> tree;
+
+        // Array of built trees, empty in mapped ones
+        Eigen::MatrixXd ownedCentres;
+
+        // Centre of every node's ball, one node per column
+        double const *centres = nullptr;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        double squaredDistanceToBall
+                (int node,
+                 Eigen::Ref<Eigen::VectorXd const> const &query) const;
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_BALL_TREE_HPP
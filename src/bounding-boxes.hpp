@@ -0,0 +1,68 @@
+#ifndef IAD_2A_BOUNDING_BOXES_HPP
+#define IAD_2A_BOUNDING_BOXES_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include <Eigen/Eigen>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////////// | Namespace: BoundingBoxes <
+    // Axis-aligned boxes around points, kept by the nodes of KdTree and
+    // BasicCentreTree as a column of lower bounds and one of upper bounds
+    namespace BoundingBoxes
+    {
+        //=================================================== | Behaviour <<
+        //-------------------------------------------------------- | Main <<<
+        // Sets column box of lowerBounds and upperBounds to the box around
+        // the columns of points listed in indices, from begin to end
+        template <typename Points, typename Scalar>
+        void calculate
+                (Eigen::MatrixBase<Points> const &points,
+                 int const *const indices,
+                 int const begin,
+                 int const end,
+                 Eigen::Index const box,
+                 Eigen::MatrixX<Scalar> &lowerBounds,
+                 Eigen::MatrixX<Scalar> &upperBounds)
+        {
+            lowerBounds.col(box) = points.col(indices[begin]);
+            upperBounds.col(box) = points.col(indices[begin]);
+
+            for (int i = begin + 1; i < end; ++i)
+            {
+                lowerBounds.col(box)
+                        = lowerBounds.col(box).cwiseMin(points.col(indices[i]));
+                upperBounds.col(box)
+                        = upperBounds.col(box).cwiseMax(points.col(indices[i]));
+            }
+        }
+
+        template <typename Lower, typename Upper>
+        Eigen::Index widestDimension
+                (Eigen::MatrixBase<Lower> const &lowerBound,
+                 Eigen::MatrixBase<Upper> const &upperBound)
+        {
+            Eigen::Index dimension;
+            (upperBound - lowerBound).maxCoeff(&dimension);
+
+            return dimension;
+        }
+
+        // Zero for points inside the box
+        template <typename Lower, typename Upper, typename Point>
+        typename Point::Scalar squaredDistance
+                (Eigen::MatrixBase<Lower> const &lowerBound,
+                 Eigen::MatrixBase<Upper> const &upperBound,
+                 Eigen::MatrixBase<Point> const &point)
+        {
+            using Scalar = typename Point::Scalar;
+
+            return ((lowerBound - point).cwiseMax(Scalar(0))
+                    + (point - upperBound).cwiseMax(Scalar(0)))
+                    .squaredNorm();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_BOUNDING_BOXES_HPP
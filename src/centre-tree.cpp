@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "centre-tree.hpp"
+#include "bounding-boxes.hpp"
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////// | Using declarations
+template <typename Scalar>
+using MatrixReference = Eigen::Ref<Eigen::MatrixX<Scalar> const>;
+
+template <typename Scalar>
+using VectorReference = Eigen::Ref<Eigen::VectorX<Scalar> const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////////////////////// | Class: BasicCentreTree <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    template <typename Scalar>
+    BasicCentreTree<Scalar>::BasicCentreTree
+            (MatrixReference<Scalar> const &centres,
+             VectorReference<Scalar> const &radii)
+            :
+            tree { static_cast<int>(centres.cols()),
+                   static_cast<int>(centres.rows()),
+                   leafSize }
+    {
+        lowerBounds.resize(centres.cols(), tree.maximumNumberOfNodes());
+        upperBounds.resize(centres.cols(), tree.maximumNumberOfNodes());
+
+        // Median of the widest dimension of the node's box
+        tree.build([this, &centres, &radii](Node &node, int const index)
+                   {
+                       int const *const rows = tree.getOrder();
+
+                       BoundingBoxes::calculate(centres.transpose(),
+                                                rows,
+                                                node.begin,
+                                                node.end,
+                                                index,
+                                                lowerBounds,
+                                                upperBounds);
+
+                       node.maximumRadius = radii(rows[node.begin]);
+
+                       for (int i = node.begin + 1; i < node.end; ++i)
+                           node.maximumRadius = std::max(node.maximumRadius,
+                                                         radii(rows[i]));
+                   },
+                   [this, &centres](Node const &, int const index)
+                   {
+                       Eigen::Index const dimension
+                               = BoundingBoxes::widestDimension
+                                       (lowerBounds.col(index),
+                                        upperBounds.col(index));
+
+                       return [&centres, dimension](int const row)
+                       {
+                           return centres(row, dimension);
+                       };
+                   });
+
+        lowerBounds.conservativeResize(Eigen::NoChange,
+                                       tree.getNumberOfNodes());
+        upperBounds.conservativeResize(Eigen::NoChange,
+                                       tree.getNumberOfNodes());
+
+        // Centres are stored in tree order so that leaves are contiguous
+        int const *const rows = tree.getOrder();
+
+        this->centres.resize(centres.cols(), centres.rows());
+        this->radii.resize(radii.size());
+
+        for (int i = 0; i < static_cast<int>(centres.rows()); ++i)
+        {
+            this->centres.col(i) = centres.row(rows[i]).transpose();
+            this->radii(i) = radii(rows[i]);
+        }
+    }
+
+    //--------------------------------------------------------------- | Main <<<
+    template <typename Scalar>
+    void BasicCentreTree<Scalar>::findCentresReaching
+            (VectorReference<Scalar> const &point,
+             std::vector<int> &indices) const
+    {
+        indices.clear();
+
+        if (tree.isEmpty())
+            return;
+
+        int const *const rows = tree.getOrder();
+        Node const *const nodes = tree.getNodes();
+
+        int pendingNodes[64];
+        int numberOfPendingNodes = 0;
+        pendingNodes[numberOfPendingNodes++] = 0;
+
+        while (numberOfPendingNodes > 0)
+        {
+            int const index = pendingNodes[--numberOfPendingNodes];
+            Node const &node = nodes[index];
+
+            Scalar const squaredDistanceToBox
+                    = BoundingBoxes::squaredDistance(lowerBounds.col(index),
+                                                     upperBounds.col(index),
+                                                     point);
+
+            if (squaredDistanceToBox > node.maximumRadius * node.maximumRadius)
+                continue;
+
+            if (node.left < 0)
+            {
+                for (int i = node.begin; i < node.end; ++i)
+                    if ((centres.col(i) - point).squaredNorm()
+                        <= radii(i) * radii(i))
+                        indices.push_back(rows[i]);
+
+                continue;
+            }
+
+            pendingNodes[numberOfPendingNodes++] = node.left;
+            pendingNodes[numberOfPendingNodes++] = node.right;
+        }
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    template <typename Scalar>
+    bool BasicCentreTree<Scalar>::isEmpty
+            () const
+    {
+        return tree.isEmpty();
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicCentreTree<float>;
+    template class BasicCentreTree<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
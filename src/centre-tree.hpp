@@ -0,0 +1,69 @@
+#ifndef IAD_2A_CENTRE_TREE_HPP
+#define IAD_2A_CENTRE_TREE_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "search-tree.hpp"
+
+#include <Eigen/Eigen>
+#include <vector>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////////////////////// | Class: BasicCentreTree <
+    // Kd-tree over centres that each reach as far as their own radius. Nodes
+    // keep the bounding box of their centres and the largest radius among
+    // them, so whole subtrees out of reach of a point are skipped.
+    template <typename Scalar>
+    class BasicCentreTree final
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        BasicCentreTree
+                () = default;
+
+        // One centre per row, as the weights of a radial basis function layer
+        explicit BasicCentreTree
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &centres,
+                 Eigen::Ref<Eigen::VectorX<Scalar> const> const &radii);
+
+        //----------------------------------------------------------- | Main <<<
+        // Replaces the contents of indices with the rows of all centres whose
+        // radius reaches the point, in no particular order
+        void findCentresReaching
+                (Eigen::Ref<Eigen::VectorX<Scalar> const> const &point,
+                 std::vector<int> &indices) const;
+
+        //--------------------------------------------------------- | Traits <<<
+        bool isEmpty
+                () const;
+
+    private:
+        //====================================================== | Structures <<
+        struct Node
+        {
+            int begin, end;
+            int left, right;
+            Scalar maximumRadius;
+        };
+
+        //============================================================ | Data <<
+        static constexpr int leafSize = 16;
+
+        // Nodes, with the rows of the centres in tree order
+        SearchTree<Node> tree;
+
+        // Centres and radii in tree order, one centre per column
+        Eigen::MatrixX<Scalar> centres;
+        Eigen::VectorX<Scalar> radii;
+
+        // Bounding box of every node, one node per column
+        Eigen::MatrixX<Scalar> lowerBounds, upperBounds;
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using CentreTree = BasicCentreTree<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_CENTRE_TREE_HPP
@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "confusion-matrix-accumulator.hpp"
+
+/////////////////////////////////////////////////////////// | Using declarations
+template <typename Scalar>
+using MatrixReference = Eigen::Ref<Eigen::MatrixX<Scalar> const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////// | Class: BasicConfusionMatrixAccumulator <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    template <typename Scalar>
+    BasicConfusionMatrixAccumulator<Scalar>::BasicConfusionMatrixAccumulator
+            (int const numberOfClasses)
+            :
+            counts { Eigen::MatrixXi::Zero(numberOfClasses, numberOfClasses) }
+    {
+    }
+
+    //------------- | Interface: BasicEvaluationAccumulator | Implementation <<<
+    template <typename Scalar>
+    void BasicConfusionMatrixAccumulator<Scalar>::accumulate
+            (MatrixReference<Scalar> const &outputs,
+             MatrixReference<Scalar> const &targets)
+    {
+        for (Eigen::Index i = 0; i < outputs.cols(); ++i)
+        {
+            Eigen::Index predictedClass, actualClass;
+            outputs.col(i).maxCoeff(&predictedClass);
+            targets.col(i).maxCoeff(&actualClass);
+
+            counts(predictedClass, actualClass)++;
+        }
+    }
+
+    template <typename Scalar>
+    void BasicConfusionMatrixAccumulator<Scalar>::reset
+            ()
+    {
+        counts.setZero();
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    template <typename Scalar>
+    Eigen::MatrixXi const &
+    BasicConfusionMatrixAccumulator<Scalar>::confusionMatrix
+            () const
+    {
+        return counts;
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicConfusionMatrixAccumulator<float>;
+    template class BasicConfusionMatrixAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,47 @@
+#ifndef IAD_2A_CONFUSION_MATRIX_ACCUMULATOR_HPP
+#define IAD_2A_CONFUSION_MATRIX_ACCUMULATOR_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "evaluation-accumulator.hpp"
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////// | Class: BasicConfusionMatrixAccumulator <
+    template <typename Scalar>
+    class BasicConfusionMatrixAccumulator final
+            : public BasicEvaluationAccumulator<Scalar>
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        explicit BasicConfusionMatrixAccumulator
+                (int numberOfClasses);
+
+        //----------------------------------------------------- | Destructor <<<
+        ~BasicConfusionMatrixAccumulator
+                () noexcept final = default;
+
+        //--------- | Interface: BasicEvaluationAccumulator | Implementation <<<
+        void accumulate
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &targets) final;
+
+        void reset
+                () final;
+
+        //--------------------------------------------------------- | Traits <<<
+        // Rows are predicted classes, columns are actual classes
+        Eigen::MatrixXi const &confusionMatrix
+                () const;
+
+    private:
+        //============================================================ | Data <<
+        Eigen::MatrixXi counts;
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using ConfusionMatrixAccumulator = BasicConfusionMatrixAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_CONFUSION_MATRIX_ACCUMULATOR_HPP
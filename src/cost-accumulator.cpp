@@ -0,0 +1,61 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "cost-accumulator.hpp"
+
+/////////////////////////////////////////////////////////// | Using declarations
+template <typename Scalar>
+using MatrixReference = Eigen::Ref<Eigen::MatrixX<Scalar> const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    //////////////////////////////////////////// | Class: BasicCostAccumulator <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    template <typename Scalar>
+    BasicCostAccumulator<Scalar>::BasicCostAccumulator
+            ()
+            :
+            totalCost { 0.0 },
+            examplesCount { 0 }
+    {
+    }
+
+    //------------- | Interface: BasicEvaluationAccumulator | Implementation <<<
+    template <typename Scalar>
+    void BasicCostAccumulator<Scalar>::accumulate
+            (MatrixReference<Scalar> const &outputs,
+             MatrixReference<Scalar> const &targets)
+    {
+        totalCost += static_cast<double>((targets - outputs).squaredNorm());
+        examplesCount += outputs.cols();
+    }
+
+    template <typename Scalar>
+    void BasicCostAccumulator<Scalar>::reset
+            ()
+    {
+        totalCost = 0.0;
+        examplesCount = 0;
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    template <typename Scalar>
+    double BasicCostAccumulator<Scalar>::cost
+            () const
+    {
+        return examplesCount > 0 ? totalCost / examplesCount : 0.0;
+    }
+
+    template <typename Scalar>
+    long BasicCostAccumulator<Scalar>::numberOfExamples
+            () const
+    {
+        return examplesCount;
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicCostAccumulator<float>;
+    template class BasicCostAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,51 @@
+#ifndef IAD_2A_COST_ACCUMULATOR_HPP
+#define IAD_2A_COST_ACCUMULATOR_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "evaluation-accumulator.hpp"
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    //////////////////////////////////////////// | Class: BasicCostAccumulator <
+    template <typename Scalar>
+    class BasicCostAccumulator final
+            : public BasicEvaluationAccumulator<Scalar>
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        BasicCostAccumulator
+                ();
+
+        //----------------------------------------------------- | Destructor <<<
+        ~BasicCostAccumulator
+                () noexcept final = default;
+
+        //--------- | Interface: BasicEvaluationAccumulator | Implementation <<<
+        void accumulate
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &targets) final;
+
+        void reset
+                () final;
+
+        //--------------------------------------------------------- | Traits <<<
+        // Sum of squared errors averaged over examples, as in test()
+        double cost
+                () const;
+
+        long numberOfExamples
+                () const;
+
+    private:
+        //============================================================ | Data <<
+        double totalCost;
+        long examplesCount;
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using CostAccumulator = BasicCostAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_COST_ACCUMULATOR_HPP
@@ -12,17 +12,19 @@
 
 #include <Eigen/Eigen>
 
-using Array = Eigen::ArrayXd;
-using Matrix = Eigen::MatrixXd;
-using Vector = Eigen::VectorXd;
-
 ////////////////////////////////////////////// | cereal: Archive specialisations
 namespace cereal
 {
-    template <typename Archive>
+    // Matrices and vectors of any scalar type are stored as their dimensions
+    // followed by raw column-major data, so float and double networks differ
+    // only in the element size
+    template <typename Archive,
+              typename Scalar,
+              int Rows, int Columns, int Options, int MaxRows, int MaxColumns>
     void save
             (Archive &archive,
-             Matrix const &matrix)
+             Eigen::Matrix<Scalar, Rows, Columns,
+                           Options, MaxRows, MaxColumns> const &matrix)
     {
         int matrixRows = matrix.rows();
         int matrixColumns = matrix.cols();
@@ -31,13 +33,16 @@ namespace cereal
         archive(matrixColumns);
 
         archive(binary_data(matrix.data(),
-                            matrixRows * matrixColumns * sizeof(double)));
+                            matrixRows * matrixColumns * sizeof(Scalar)));
     }
 
-    template <typename Archive>
+    template <typename Archive,
+              typename Scalar,
+              int Rows, int Columns, int Options, int MaxRows, int MaxColumns>
     void load
             (Archive &archive,
-             Matrix &matrix)
+             Eigen::Matrix<Scalar, Rows, Columns,
+                           Options, MaxRows, MaxColumns> &matrix)
     {
         int matrixRows = matrix.rows();
         int matrixColumns = matrix.cols();
@@ -48,25 +53,7 @@ namespace cereal
         matrix.resize(matrixRows, matrixColumns);
 
         archive(binary_data(matrix.data(),
-                            matrixRows * matrixColumns * sizeof(double)));
-    }
-
-    template <typename Archive>
-    void save
-            (Archive &archive,
-             Vector const &vector)
-    {
-        save(archive, Matrix { vector });
-    }
-
-    template <typename Archive>
-    void load
-            (Archive &archive,
-             Vector &vector)
-    {
-        Matrix vectorAsMatrix;
-        load(archive, vectorAsMatrix);
-        vector = vectorAsMatrix;
+                            matrixRows * matrixColumns * sizeof(Scalar)));
     }
 }
 
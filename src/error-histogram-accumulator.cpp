@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "error-histogram-accumulator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+/////////////////////////////////////////////////////////// | Using declarations
+template <typename Scalar>
+using MatrixReference = Eigen::Ref<Eigen::MatrixX<Scalar> const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////// | Class: BasicErrorHistogramAccumulator <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    template <typename Scalar>
+    BasicErrorHistogramAccumulator<Scalar>::BasicErrorHistogramAccumulator
+            (double const minimumError,
+             double const maximumError,
+             int const numberOfBins)
+            :
+            minimumError { minimumError },
+            width { (maximumError - minimumError) / numberOfBins },
+            numberOfNotANumberErrors { 0 }
+    {
+        if (numberOfBins <= 0)
+            throw std::invalid_argument("Histogram without bins");
+
+        // Also rejects NaN bounds
+        if (!(maximumError > minimumError))
+            throw std::invalid_argument("Empty range of errors");
+
+        counts.setZero(numberOfBins);
+    }
+
+    //------------- | Interface: BasicEvaluationAccumulator | Implementation <<<
+    template <typename Scalar>
+    void BasicErrorHistogramAccumulator<Scalar>::accumulate
+            (MatrixReference<Scalar> const &outputs,
+             MatrixReference<Scalar> const &targets)
+    {
+        int const lastBin = static_cast<int>(counts.size()) - 1;
+
+        for (Eigen::Index j = 0; j < outputs.cols(); ++j)
+            for (Eigen::Index i = 0; i < outputs.rows(); ++i)
+            {
+                double const error = targets(i, j) - outputs(i, j);
+
+                // Diverged training yields NaN outputs, which have no bin
+                if (std::isnan(error))
+                {
+                    ++numberOfNotANumberErrors;
+                    continue;
+                }
+
+                double const bin = std::floor((error - minimumError) / width);
+
+                counts(static_cast<int>(std::clamp(bin, 0.0,
+                                                   double(lastBin))))++;
+            }
+    }
+
+    template <typename Scalar>
+    void BasicErrorHistogramAccumulator<Scalar>::reset
+            ()
+    {
+        counts.setZero();
+        numberOfNotANumberErrors = 0;
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    template <typename Scalar>
+    Eigen::VectorXi const &BasicErrorHistogramAccumulator<Scalar>::bins
+            () const
+    {
+        return counts;
+    }
+
+    template <typename Scalar>
+    long BasicErrorHistogramAccumulator<Scalar>::notANumberCount
+            () const
+    {
+        return numberOfNotANumberErrors;
+    }
+
+    template <typename Scalar>
+    double BasicErrorHistogramAccumulator<Scalar>::binLowerBound
+            (int const bin) const
+    {
+        return minimumError + bin * width;
+    }
+
+    template <typename Scalar>
+    double BasicErrorHistogramAccumulator<Scalar>::binWidth
+            () const
+    {
+        return width;
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicErrorHistogramAccumulator<float>;
+    template class BasicErrorHistogramAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
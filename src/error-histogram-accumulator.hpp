@@ -0,0 +1,64 @@
+#ifndef IAD_2A_ERROR_HISTOGRAM_ACCUMULATOR_HPP
+#define IAD_2A_ERROR_HISTOGRAM_ACCUMULATOR_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "evaluation-accumulator.hpp"
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////// | Class: BasicErrorHistogramAccumulator <
+    template <typename Scalar>
+    class BasicErrorHistogramAccumulator final
+            : public BasicEvaluationAccumulator<Scalar>
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        // Throws unless there are bins and minimumError < maximumError
+        BasicErrorHistogramAccumulator
+                (double minimumError,
+                 double maximumError,
+                 int numberOfBins = 16);
+
+        //----------------------------------------------------- | Destructor <<<
+        ~BasicErrorHistogramAccumulator
+                () noexcept final = default;
+
+        //--------- | Interface: BasicEvaluationAccumulator | Implementation <<<
+        // Counts every output's error (target minus output); errors outside
+        // of the range fall into the first or the last bin, and NaN errors
+        // are counted apart
+        void accumulate
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &targets) final;
+
+        void reset
+                () final;
+
+        //--------------------------------------------------------- | Traits <<<
+        Eigen::VectorXi const &bins
+                () const;
+
+        long notANumberCount
+                () const;
+
+        double binLowerBound
+                (int bin) const;
+
+        double binWidth
+                () const;
+
+    private:
+        //============================================================ | Data <<
+        double minimumError;
+        double width;
+        Eigen::VectorXi counts;
+        long numberOfNotANumberErrors;
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using ErrorHistogramAccumulator = BasicErrorHistogramAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_ERROR_HISTOGRAM_ACCUMULATOR_HPP
@@ -0,0 +1,19 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "evaluation-accumulator.hpp"
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////// | Interface: BasicEvaluationAccumulator <
+    //=========================================================== | Behaviour <<
+    //--------------------------------------------------------- | Destructor <<<
+    template <typename Scalar>
+    BasicEvaluationAccumulator<Scalar>::~BasicEvaluationAccumulator
+            () noexcept = default;
+
+    //============================================== | Explicit instantiation <<
+    template class BasicEvaluationAccumulator<float>;
+    template class BasicEvaluationAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,54 @@
+#ifndef IAD_2A_EVALUATION_ACCUMULATOR_HPP
+#define IAD_2A_EVALUATION_ACCUMULATOR_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include <Eigen/Eigen>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////// | Interface: BasicEvaluationAccumulator <
+    template <typename Scalar>
+    class BasicEvaluationAccumulator
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //----------------------------------------------------- | Destructor <<<
+        virtual ~BasicEvaluationAccumulator
+                () noexcept = 0;
+
+        //----------------------------------------------------------- | Main <<<
+        // Each column holds one example's network outputs and targets.
+        // Only aggregates are kept, so memory does not grow with examples.
+        virtual void accumulate
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &targets) = 0;
+
+        virtual void reset
+                () = 0;
+
+    protected:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        BasicEvaluationAccumulator
+                () = default;
+
+        BasicEvaluationAccumulator
+                (BasicEvaluationAccumulator const &) = default;
+
+        BasicEvaluationAccumulator
+                (BasicEvaluationAccumulator &&) = default;
+
+        //------------------------------------------------------ | Operators <<<
+        BasicEvaluationAccumulator &operator=
+                (BasicEvaluationAccumulator const &) = default;
+
+        BasicEvaluationAccumulator &operator=
+                (BasicEvaluationAccumulator &&) = default;
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using EvaluationAccumulator = BasicEvaluationAccumulator<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_EVALUATION_ACCUMULATOR_HPP
@@ -0,0 +1,368 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "hnsw-graph.hpp"
+#include "activation-kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <random>
+
+/////////////////////////////////////////////////////////// | Using declarations
+using MatrixReference = Eigen::Ref<Eigen::MatrixXd const>;
+using VectorReference = Eigen::Ref<Eigen::VectorXd const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    /////////////////////////////////////////////////////// | Class: HnswGraph <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    HnswGraph::HnswGraph
+            (MatrixReference const &points,
+             int const numberOfLinks,
+             int const constructionBreadth)
+            :
+            numberOfLinks { std::max(numberOfLinks, 2) },
+            constructionBreadth { std::max(constructionBreadth, 1) },
+            numberOfPoints { static_cast<int>(points.cols()) },
+            layers(points.cols(), 0),
+            ownedBaseLinks(points.cols() * (1 + capacity(0)), 0),
+            ownedUpperOffsets(points.cols() + 1, 0)
+    {
+        // Layers drawn so that each holds about 1 / numberOfLinks of the
+        // points of the layer below. Seeds come from rand(), as the layers'.
+        std::mt19937 generator(static_cast<unsigned int>(std::rand()));
+        std::uniform_real_distribution<double> uniform { 0.0, 1.0 };
+
+        double const levelMultiplier = 1.0 / std::log(this->numberOfLinks);
+
+        for (Eigen::Index i = 0; i < points.cols(); ++i)
+        {
+            layers[i] = std::min
+                    (maximumNumberOfLayers - 1,
+                     static_cast<int>(-std::log(1.0 - uniform(generator))
+                                      * levelMultiplier));
+
+            ownedUpperOffsets[i + 1]
+                    = ownedUpperOffsets[i]
+                      + std::size_t(layers[i]) * (1 + capacity(1));
+        }
+
+        ownedUpperLinks.assign(ownedUpperOffsets.back(), 0);
+
+        baseLinks = ownedBaseLinks.data();
+        upperLinks = ownedUpperLinks.data();
+        upperOffsets = ownedUpperOffsets.data();
+
+        Scratch scratch;
+
+        for (Eigen::Index i = 0; i < points.cols(); ++i)
+            insert(points, static_cast<int>(i), scratch);
+    }
+
+    HnswGraph::HnswGraph
+            (MappedIndexFile &file)
+            :
+            numberOfLinks { file.read<int>() },
+            constructionBreadth { file.read<int>() },
+            entryPoint { file.read<int>() },
+            topLayer { file.read<int>() }
+    {
+        std::size_t size;
+
+        upperOffsets = file.readArray<std::size_t>(size);
+        numberOfPoints = static_cast<int>(size) - 1;
+
+        baseLinks = file.readArray<int>(size);
+
+        if (numberOfPoints < 0
+            || size != std::size_t(numberOfPoints) * (1 + capacity(0)))
+            throw std::runtime_error("Corrupt index file");
+
+        upperLinks = file.readArray<int>(size);
+
+        if (size != upperOffsets[numberOfPoints])
+            throw std::runtime_error("Corrupt index file");
+    }
+
+    //--------------------------------------------------------------- | Main <<<
+    void HnswGraph::findNearest
+            (MatrixReference const &points,
+             VectorReference const &query,
+             NeighbourHeap &neighbours,
+             int const searchBreadth,
+             Scratch &scratch) const
+    {
+        if (entryPoint < 0)
+            return;
+
+        scratch.results.assign
+                (1, { squaredDistance(points, entryPoint, query),
+                      entryPoint });
+
+        for (int layer = topLayer; layer > 0; --layer)
+            searchLayer(points, query, layer, 1, scratch);
+
+        searchLayer(points, query, 0, std::max(searchBreadth, 1), scratch);
+
+        for (auto const &[squaredDistance, point]
+                : scratch.results)
+            neighbours.push(squaredDistance, point);
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    bool HnswGraph::isEmpty
+            () const
+    {
+        return entryPoint < 0;
+    }
+
+    //------------------------------------------------------ | Serialization <<<
+    void HnswGraph::writeToFile
+            (IndexFileWriter &file) const
+    {
+        file.write(numberOfLinks);
+        file.write(constructionBreadth);
+        file.write(entryPoint);
+        file.write(topLayer);
+        file.writeArray(upperOffsets, std::size_t(numberOfPoints) + 1);
+        file.writeArray(baseLinks,
+                        std::size_t(numberOfPoints) * (1 + capacity(0)));
+        file.writeArray(upperLinks, upperOffsets[numberOfPoints]);
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    void HnswGraph::insert
+            (MatrixReference const &points,
+             int const point,
+             Scratch &scratch)
+    {
+        int const pointLayer = layers[point];
+
+        if (entryPoint < 0)
+        {
+            entryPoint = point;
+            topLayer = pointLayer;
+            return;
+        }
+
+        auto const query = points.col(point);
+
+        scratch.results.assign
+                (1, { squaredDistance(points, entryPoint, query),
+                      entryPoint });
+
+        for (int layer = topLayer; layer > pointLayer; --layer)
+            searchLayer(points, query, layer, 1, scratch);
+
+        std::vector<Neighbour> selected;
+
+        for (int layer = std::min(pointLayer, topLayer); layer >= 0; --layer)
+        {
+            searchLayer(points, query, layer, constructionBreadth, scratch);
+
+            // Points found stay the entry points of the layer below
+            selected = scratch.results;
+            std::sort(selected.begin(), selected.end());
+            selectLinks(points, selected, numberOfLinks);
+
+            int *const pointLinks = links(point, layer);
+            pointLinks[0] = static_cast<int>(selected.size());
+
+            for (std::size_t i = 0; i < selected.size(); ++i)
+            {
+                pointLinks[1 + i] = selected[i].second;
+                link(points,
+                     selected[i].second,
+                     point,
+                     selected[i].first,
+                     layer);
+            }
+        }
+
+        if (pointLayer > topLayer)
+        {
+            entryPoint = point;
+            topLayer = pointLayer;
+        }
+    }
+
+    void HnswGraph::searchLayer
+            (MatrixReference const &points,
+             VectorReference const &query,
+             int const layer,
+             int const breadth,
+             Scratch &scratch) const
+    {
+        auto &[visits, visit, candidates, results] = scratch;
+
+        if (visits.size() < static_cast<std::size_t>(points.cols()))
+            visits.resize(points.cols(), 0);
+
+        if (++visit == 0)
+        {
+            std::fill(visits.begin(), visits.end(), 0);
+            visit = 1;
+        }
+
+        // Candidates in a min-heap to expand the nearest first, results in
+        // a max-heap to drop the farthest
+        auto const nearer = std::greater<Neighbour>();
+
+        candidates = results;
+        std::make_heap(candidates.begin(), candidates.end(), nearer);
+        std::make_heap(results.begin(), results.end());
+
+        for (auto const &[squaredDistance, point]
+                : results)
+            visits[point] = visit;
+
+        while (!candidates.empty())
+        {
+            std::pop_heap(candidates.begin(), candidates.end(), nearer);
+            Neighbour const candidate = candidates.back();
+            candidates.pop_back();
+
+            if (candidate.first > results.front().first
+                && static_cast<int>(results.size()) >= breadth)
+                break;
+
+            int const *const candidateLinks = links(candidate.second, layer);
+
+            for (int i = 1; i <= candidateLinks[0]; ++i)
+            {
+                int const point = candidateLinks[i];
+
+                if (visits[point] == visit)
+                    continue;
+
+                visits[point] = visit;
+
+                double const distance = squaredDistance(points, point, query);
+
+                if (static_cast<int>(results.size()) < breadth
+                    || distance < results.front().first)
+                {
+                    candidates.emplace_back(distance, point);
+                    std::push_heap(candidates.begin(),
+                                   candidates.end(),
+                                   nearer);
+
+                    results.emplace_back(distance, point);
+                    std::push_heap(results.begin(), results.end());
+
+                    if (static_cast<int>(results.size()) > breadth)
+                    {
+                        std::pop_heap(results.begin(), results.end());
+                        results.pop_back();
+                    }
+                }
+            }
+        }
+    }
+
+    void HnswGraph::selectLinks
+            (MatrixReference const &points,
+             std::vector<Neighbour> &candidates,
+             int const maximumNumberOfLinks) const
+    {
+        std::size_t numberOfSelected = 0;
+
+        for (std::size_t i = 0;
+             i < candidates.size()
+             && numberOfSelected < std::size_t(maximumNumberOfLinks);
+             ++i)
+        {
+            bool isSelected = true;
+
+            for (std::size_t j = 0; j < numberOfSelected && isSelected; ++j)
+                isSelected = squaredDistance(points,
+                                             candidates[j].second,
+                                             points.col(candidates[i].second))
+                             >= candidates[i].first;
+
+            if (isSelected)
+                candidates[numberOfSelected++] = candidates[i];
+        }
+
+        candidates.resize(numberOfSelected);
+    }
+
+    void HnswGraph::link
+            (MatrixReference const &points,
+             int const point,
+             int const neighbour,
+             double const squaredDistance,
+             int const layer)
+    {
+        int *const pointLinks = links(point, layer);
+
+        if (pointLinks[0] < capacity(layer))
+        {
+            pointLinks[1 + pointLinks[0]++] = neighbour;
+            return;
+        }
+
+        // A full block keeps the best spread of its links and the new one
+        std::vector<Neighbour> candidates { { squaredDistance, neighbour } };
+
+        for (int i = 1; i <= pointLinks[0]; ++i)
+            candidates.emplace_back
+                    (HnswGraph::squaredDistance(points,
+                                                pointLinks[i],
+                                                points.col(point)),
+                     pointLinks[i]);
+
+        std::sort(candidates.begin(), candidates.end());
+        selectLinks(points, candidates, capacity(layer));
+
+        pointLinks[0] = static_cast<int>(candidates.size());
+        for (std::size_t i = 0; i < candidates.size(); ++i)
+            pointLinks[1 + i] = candidates[i].second;
+    }
+
+    int *HnswGraph::links
+            (int const point,
+             int const layer)
+    {
+        return const_cast<int *>
+                (static_cast<HnswGraph const &>(*this).links(point, layer));
+    }
+
+    int const *HnswGraph::links
+            (int const point,
+             int const layer) const
+    {
+        if (layer == 0)
+            return baseLinks + std::size_t(point) * (1 + capacity(0));
+
+        return upperLinks
+               + upperOffsets[point]
+               + std::size_t(layer - 1) * (1 + capacity(layer));
+    }
+
+    int HnswGraph::capacity
+            (int const layer) const
+    {
+        return layer == 0 ? 2 * numberOfLinks : numberOfLinks;
+    }
+
+    double HnswGraph::squaredDistance
+            (MatrixReference const &points,
+             int const point,
+             VectorReference const &query)
+    {
+        double squaredDistance;
+
+        ActivationKernels::squaredDistances(points.col(point).data(),
+                                            points.rows(),
+                                            1,
+                                            query.data(),
+                                            &squaredDistance);
+
+        return squaredDistance;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
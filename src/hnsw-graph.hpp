@@ -0,0 +1,166 @@
+#ifndef IAD_2A_HNSW_GRAPH_HPP
+#define IAD_2A_HNSW_GRAPH_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "index-file.hpp"
+#include "neighbour-heap.hpp"
+
+#include <Eigen/Eigen>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    /////////////////////////////////////////////////////// | Class: HnswGraph <
+    // Approximate nearest neighbours search through a hierarchical navigable
+    // small world graph. Every point is linked to near points on layer 0 and
+    // on a random number of sparser layers above it; queries descend greedily
+    // from the top layer and widen into a best-first search on layer 0.
+    // Links of every point and layer sit in fixed-size blocks of two flat
+    // arrays, owned or mapped from an index file. Like KdTree, the points
+    // are passed to every query.
+    class HnswGraph final
+    {
+    public:
+        //=========================================================== | Types <<
+        using Neighbour = NeighbourHeap::Neighbour;
+
+        //====================================================== | Structures <<
+        // Buffers of a search, one set per thread
+        struct Scratch
+        {
+            std::vector<std::uint32_t> visits;
+            std::uint32_t visit = 0;
+
+            std::vector<Neighbour> candidates, results;
+        };
+
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        HnswGraph
+                () = default;
+
+        // One point per column. Every point keeps up to numberOfLinks links
+        // per layer, twice as many on layer 0, chosen among the
+        // constructionBreadth nearest points found when it is inserted.
+        explicit HnswGraph
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 int numberOfLinks = 16,
+                 int constructionBreadth = 200);
+
+        // Maps a graph written by writeToFile, which has to outlive it.
+        // Mapped graphs are only searched, never extended.
+        explicit HnswGraph
+                (MappedIndexFile &file);
+
+        // Copies would point into the original's arrays
+        HnswGraph
+                (HnswGraph const &) = delete;
+
+        HnswGraph
+                (HnswGraph &&) = default;
+
+        HnswGraph &operator=
+                (HnswGraph const &) = delete;
+
+        HnswGraph &operator=
+                (HnswGraph &&) = default;
+
+        //----------------------------------------------------------- | Main <<<
+        // Pushes the nearest points found into neighbours. Wider searches
+        // find more of the true nearest points and take longer; the breadth
+        // should not be smaller than the number of neighbours wanted.
+        void findNearest
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 Eigen::Ref<Eigen::VectorXd const> const &query,
+                 NeighbourHeap &neighbours,
+                 int searchBreadth,
+                 Scratch &scratch) const;
+
+        //--------------------------------------------------------- | Traits <<<
+        bool isEmpty
+                () const;
+
+        //-------------------------------------------------- | Serialization <<<
+        void writeToFile
+                (IndexFileWriter &file) const;
+
+    private:
+        //============================================================ | Data <<
+        static constexpr int maximumNumberOfLayers = 16;
+
+        int numberOfLinks = 16;
+        int constructionBreadth = 200;
+
+        int entryPoint = -1;
+        int topLayer = -1;
+        int numberOfPoints = 0;
+
+        // Highest layer of every point, needed while inserting only
+        std::vector<int> layers;
+
+        // Arrays of built graphs, empty in mapped ones
+        std::vector<int> ownedBaseLinks;
+        std::vector<int> ownedUpperLinks;
+        std::vector<std::size_t> ownedUpperOffsets;
+
+        // Blocks of a count followed by that many links: one block per point
+        // on layer 0, and one per point and layer above it, starting at the
+        // point's offset
+        int const *baseLinks = nullptr;
+        int const *upperLinks = nullptr;
+        std::size_t const *upperOffsets = nullptr;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        void insert
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 int point,
+                 Scratch &scratch);
+
+        // Best-first search of one layer from the entry points in
+        // scratch.results, which it replaces with the nearest points found
+        void searchLayer
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 Eigen::Ref<Eigen::VectorXd const> const &query,
+                 int layer,
+                 int breadth,
+                 Scratch &scratch) const;
+
+        // Keeps candidates, sorted from the nearest, that are nearer to the
+        // base point than to any candidate kept before them, which spreads
+        // links in all directions
+        void selectLinks
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 std::vector<Neighbour> &candidates,
+                 int maximumNumberOfLinks) const;
+
+        void link
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 int point,
+                 int neighbour,
+                 double squaredDistance,
+                 int layer);
+
+        int *links
+                (int point,
+                 int layer);
+
+        int const *links
+                (int point,
+                 int layer) const;
+
+        int capacity
+                (int layer) const;
+
+        static double squaredDistance
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 int point,
+                 Eigen::Ref<Eigen::VectorXd const> const &query);
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_HNSW_GRAPH_HPP
@@ -1,32 +1,87 @@
 ///////////////////////////////////////////////////////////////////// | Includes
 #include "identity.hpp"
+#include "activation-kernels.hpp"
 
 /////////////////////////////////////////////////////////// | Using declarations
-using Array = Eigen::ArrayXd;
+template <typename Scalar>
+using Array = Eigen::ArrayX<Scalar>;
+
+template <typename Scalar>
+using Array2DReference = Eigen::Ref<Eigen::ArrayXX<Scalar> const>;
+
+template <typename Scalar>
+using Array2DMutableReference = Eigen::Ref<Eigen::ArrayXX<Scalar>>;
 
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    //////////////////////////////////////////////////////// | Class: Identity <
+    /////////////////////////////////////////////////// | Class: BasicIdentity <
     //=========================================================== | Behaviour <<
     //------------------------------ | Interface: Cloneable | Implementation <<<
-    std::unique_ptr<ActivationFunction> Identity::clone
+    template <typename Scalar>
+    std::unique_ptr<BasicActivationFunction<Scalar>>
+    BasicIdentity<Scalar>::clone
             () const
     {
-        return std::make_unique<Identity>(*this);
+        return std::make_unique<BasicIdentity>(*this);
     }
 
     //--------------------- | Interface: ActivationFunction | Implementation <<<
-    Array Identity::operator()
-            (Array const &input) const
+    template <typename Scalar>
+    Array<Scalar> BasicIdentity<Scalar>::operator()
+            (Array<Scalar> const &input) const
+    {
+        Array<Scalar> outputs(input.size());
+        ActivationKernels::identity<Scalar>
+                (input.data(), outputs.data(), nullptr, input.size());
+        return outputs;
+    }
+
+    template <typename Scalar>
+    Array<Scalar> BasicIdentity<Scalar>::derivative
+            (Array<Scalar> const &input) const
+    {
+        Array<Scalar> derivatives(input.size());
+        ActivationKernels::identity<Scalar>
+                (input.data(), nullptr, derivatives.data(), input.size());
+        return derivatives;
+    }
+
+    template <typename Scalar>
+    void BasicIdentity<Scalar>::activateBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> outputs) const
+    {
+        ActivationKernels::apply<Scalar>
+                (ActivationKernels::identity<Scalar>,
+                 inputs,
+                 &outputs,
+                 nullptr);
+    }
+
+    template <typename Scalar>
+    void BasicIdentity<Scalar>::derivativeBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> derivatives) const
     {
-        return input;
+        ActivationKernels::apply<Scalar>
+                (ActivationKernels::identity<Scalar>,
+                 inputs,
+                 nullptr,
+                 &derivatives);
     }
 
-    Array Identity::derivative
-            (Array const &input) const
+    template <typename Scalar>
+    void BasicIdentity<Scalar>::activateWithDerivativeBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> outputs,
+             Array2DMutableReference<Scalar> derivatives) const
     {
-        return Array::Ones(input.size());
+        ActivationKernels::apply<Scalar>
+                (ActivationKernels::identity<Scalar>,
+                 inputs,
+                 &outputs,
+                 &derivatives);
     }
 
     //---------------------------------------------- | cereal: Serialization <<<
@@ -41,6 +96,10 @@ namespace NeuralNetworks
 //            (Archive &archive)
 //    {
 //    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicIdentity<float>;
+    template class BasicIdentity<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
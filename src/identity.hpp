@@ -9,43 +9,57 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    //////////////////////////////////////////////////////// | Class: Identity <
-    class Identity final
-            : public ActivationFunction
+    /////////////////////////////////////////////////// | Class: BasicIdentity <
+    template <typename Scalar>
+    class BasicIdentity final
+            : public BasicActivationFunction<Scalar>
     {
     public:
         //======================================================= | Behaviour <<
         //--------------------------------------------------- | Constructors <<<
-        Identity
+        BasicIdentity
                 () = default;
 
-        Identity
-                (Identity const &) = default;
+        BasicIdentity
+                (BasicIdentity const &) = default;
 
-        Identity
-                (Identity &&) = default;
+        BasicIdentity
+                (BasicIdentity &&) = default;
 
         //------------------------------------------------------ | Operators <<<
-        Identity &operator=
-                (Identity const &) = default;
+        BasicIdentity &operator=
+                (BasicIdentity const &) = default;
 
-        Identity &operator=
-                (Identity &&) = default;
+        BasicIdentity &operator=
+                (BasicIdentity &&) = default;
 
         //----------------------------------------------------- | Destructor <<<
-        ~Identity
+        ~BasicIdentity
                 () noexcept final = default;
 
         //-------------------------- | Interface: Cloneable | Implementation <<<
-        std::unique_ptr<ActivationFunction> clone
+        std::unique_ptr<BasicActivationFunction<Scalar>> clone
                 () const final;
 
         //----------------- | Interface: ActivationFunction | Implementation <<<
-        Eigen::ArrayXd operator()
-                (Eigen::ArrayXd const &input) const final;
+        Eigen::ArrayX<Scalar> operator()
+                (Eigen::ArrayX<Scalar> const &input) const final;
 
-        Eigen::ArrayXd derivative
-                (Eigen::ArrayXd const &input) const final;
+        Eigen::ArrayX<Scalar> derivative
+                (Eigen::ArrayX<Scalar> const &input) const final;
+
+        void activateBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs) const final;
+
+        void derivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const final;
+
+        void activateWithDerivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const final;
 
     private:
         //======================================================= | Behaviour <<
@@ -64,12 +78,20 @@ namespace NeuralNetworks
         {
         }
     };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using Identity = BasicIdentity<double>;
 }
 
 //////////////////////////////////////// | cereal: Polymorphic type registration
 CEREAL_REGISTER_TYPE(NeuralNetworks::Identity)
+CEREAL_REGISTER_TYPE(NeuralNetworks::BasicIdentity<float>)
+
 CEREAL_REGISTER_POLYMORPHIC_RELATION(NeuralNetworks::ActivationFunction,
                                      NeuralNetworks::Identity)
+CEREAL_REGISTER_POLYMORPHIC_RELATION
+        (NeuralNetworks::BasicActivationFunction<float>,
+         NeuralNetworks::BasicIdentity<float>)
 
 ////////////////////////////////////////////////////////////////////////////////
 #endif // IAD_2A_IDENTITY_HPP
@@ -0,0 +1,221 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "index-file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define IAD_2A_MAPPED_INDEX_FILES
+#endif
+
+/////////////////////////////////////////////////////////// | Using declarations
+using MatrixReference = Eigen::Ref<Eigen::MatrixXd const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    namespace
+    {
+        // Files are only read by builds that agree on these, since arrays
+        // of structures are mapped as they are
+        struct Header
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t byteOrder;
+            std::uint32_t sizeOfInt;
+            std::uint32_t sizeOfSize;
+            std::uint32_t sizeOfDouble;
+            std::uint32_t arrayAlignment;
+        };
+
+        Header const currentHeader
+                {
+                        { 'I', 'A', 'D', '2', 'A', 'I', 'D', 'X' },
+                        2,
+                        0x01020304,
+                        sizeof(int),
+                        sizeof(std::size_t),
+                        sizeof(double),
+                        IndexFileWriter::arrayAlignment
+                };
+    }
+
+    ///////////////////////////////////////////////// | Class: IndexFileWriter <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    IndexFileWriter::IndexFileWriter
+            (std::string const &filename)
+            :
+            file { filename,
+                   std::ios::out | std::ios::binary | std::ios::trunc }
+    {
+        if (!file)
+            throw std::runtime_error("Cannot open index file " + filename);
+
+        write(currentHeader);
+    }
+
+    //--------------------------------------------------------------- | Main <<<
+    void IndexFileWriter::writeMatrix
+            (MatrixReference const &matrix)
+    {
+        write(static_cast<std::int64_t>(matrix.rows()));
+        write(static_cast<std::int64_t>(matrix.cols()));
+
+        // Laid out as by writeArray, a column at a time since the columns
+        // of a reference may be apart
+        write(static_cast<std::uint64_t>(matrix.size()));
+        align(arrayAlignment);
+
+        for (Eigen::Index j = 0; j < matrix.cols(); ++j)
+            writeBytes(matrix.col(j).data(), matrix.rows() * sizeof(double));
+    }
+
+    void IndexFileWriter::close
+            ()
+    {
+        file.close();
+
+        if (!file)
+            throw std::runtime_error("Cannot write index file");
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    void IndexFileWriter::writeBytes
+            (void const *const bytes,
+             std::size_t const size)
+    {
+        file.write(static_cast<char const *>(bytes),
+                   static_cast<std::streamsize>(size));
+        offset += size;
+    }
+
+    void IndexFileWriter::align
+            (std::size_t const alignment)
+    {
+        static char const padding[arrayAlignment] {};
+
+        writeBytes(padding, (alignment - offset % alignment) % alignment);
+    }
+
+    ///////////////////////////////////////////////// | Class: MappedIndexFile <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    MappedIndexFile::MappedIndexFile
+            (std::string const &filename)
+    {
+#ifdef IAD_2A_MAPPED_INDEX_FILES
+        int const descriptor = ::open(filename.c_str(), O_RDONLY);
+        struct stat status {};
+
+        if (descriptor < 0 || ::fstat(descriptor, &status) != 0)
+        {
+            if (descriptor >= 0)
+                ::close(descriptor);
+
+            throw std::runtime_error("Cannot open index file " + filename);
+        }
+
+        size = static_cast<std::size_t>(status.st_size);
+
+        void *const mapping
+                = size == 0
+                  ? MAP_FAILED
+                  : ::mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+
+        // The mapping outlives the descriptor
+        ::close(descriptor);
+
+        if (mapping == MAP_FAILED)
+            throw std::runtime_error("Cannot map index file " + filename);
+
+        bytes = static_cast<unsigned char const *>(mapping);
+#else
+        std::ifstream file { filename, std::ios::in | std::ios::binary };
+
+        if (!file)
+            throw std::runtime_error("Cannot open index file " + filename);
+
+        std::vector<char> const contents
+                { std::istreambuf_iterator<char>(file),
+                  std::istreambuf_iterator<char>() };
+
+        size = contents.size();
+        buffer.resize(size / sizeof(std::max_align_t) + 1);
+        std::copy(contents.begin(), contents.end(),
+                  reinterpret_cast<char *>(buffer.data()));
+
+        bytes = reinterpret_cast<unsigned char const *>(buffer.data());
+#endif
+
+        if (size < sizeof(Header)
+            || std::memcmp(bytes, &currentHeader, sizeof(Header)) != 0)
+        {
+            unmap();
+            throw std::runtime_error("Not an index file of this build: "
+                                     + filename);
+        }
+
+        offset = sizeof(Header);
+    }
+
+    //--------------------------------------------------------- | Destructor <<<
+    MappedIndexFile::~MappedIndexFile
+            ()
+    {
+        unmap();
+    }
+
+    //--------------------------------------------------------------- | Main <<<
+    Eigen::Map<Eigen::MatrixXd const> MappedIndexFile::readMatrix
+            ()
+    {
+        auto const rows = read<std::int64_t>();
+        auto const columns = read<std::int64_t>();
+
+        std::size_t size;
+        double const *const data = readArray<double>(size);
+
+        if (rows < 0 || columns < 0
+            || size != static_cast<std::size_t>(rows * columns))
+            throw std::runtime_error("Corrupt index file");
+
+        return { data, static_cast<Eigen::Index>(rows),
+                 static_cast<Eigen::Index>(columns) };
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    void const *MappedIndexFile::readBytes
+            (std::size_t const size,
+             std::size_t const alignment)
+    {
+        offset += (alignment - offset % alignment) % alignment;
+
+        if (offset > this->size || size > this->size - offset)
+            throw std::runtime_error("Truncated index file");
+
+        void const *const bytes = this->bytes + offset;
+        offset += size;
+
+        return bytes;
+    }
+
+    void MappedIndexFile::unmap
+            ()
+    {
+#ifdef IAD_2A_MAPPED_INDEX_FILES
+        if (bytes != nullptr)
+            ::munmap(const_cast<unsigned char *>(bytes), size);
+#endif
+
+        bytes = nullptr;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,159 @@
+#ifndef IAD_2A_INDEX_FILE_HPP
+#define IAD_2A_INDEX_FILE_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include <Eigen/Eigen>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////////////////////// | Class: IndexFileWriter <
+    // Writes search indices as a flat sequence of scalars and arrays in the
+    // machine's own representation, after a header describing it. Arrays
+    // follow their length and start on cache line boundaries, so that
+    // MappedIndexFile hands out pointers straight into the file.
+    class IndexFileWriter final
+    {
+    public:
+        //============================================================ | Data <<
+        // Arrays start on multiples of this many bytes from the file's start
+        static constexpr std::size_t arrayAlignment = 64;
+
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        explicit IndexFileWriter
+                (std::string const &filename);
+
+        //----------------------------------------------------------- | Main <<<
+        template <typename Value>
+        void write
+                (Value const &value)
+        {
+            static_assert(std::is_trivially_copyable_v<Value>);
+
+            align(alignof(Value));
+            writeBytes(&value, sizeof(Value));
+        }
+
+        template <typename Value>
+        void writeArray
+                (Value const *const values,
+                 std::size_t const size)
+        {
+            static_assert(std::is_trivially_copyable_v<Value>);
+
+            write(static_cast<std::uint64_t>(size));
+            align(arrayAlignment);
+            writeBytes(values, size * sizeof(Value));
+        }
+
+        void writeMatrix
+                (Eigen::Ref<Eigen::MatrixXd const> const &matrix);
+
+        // Throws if any write failed
+        void close
+                ();
+
+    private:
+        //============================================================ | Data <<
+        std::ofstream file;
+        std::size_t offset = 0;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        void writeBytes
+                (void const *bytes,
+                 std::size_t size);
+
+        void align
+                (std::size_t alignment);
+    };
+
+    ///////////////////////////////////////////////// | Class: MappedIndexFile <
+    // Read-only memory mapping of a file written by IndexFileWriter, read in
+    // the order it was written. Arrays are not copied: the pointers returned
+    // stay valid as long as the mapping. Files are trusted beyond their
+    // header and length, as checking every index would read them in whole.
+    // Where mmap is missing, the file is read into memory instead.
+    class MappedIndexFile final
+    {
+    public:
+        //============================================================ | Data <<
+        static constexpr std::size_t arrayAlignment
+                = IndexFileWriter::arrayAlignment;
+
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        explicit MappedIndexFile
+                (std::string const &filename);
+
+        MappedIndexFile
+                (MappedIndexFile const &) = delete;
+
+        MappedIndexFile &operator=
+                (MappedIndexFile const &) = delete;
+
+        //---------------------------------------------------- | Destructor <<<
+        ~MappedIndexFile
+                ();
+
+        //----------------------------------------------------------- | Main <<<
+        template <typename Value>
+        Value read
+                ()
+        {
+            static_assert(std::is_trivially_copyable_v<Value>);
+
+            return *static_cast<Value const *>
+                    (readBytes(sizeof(Value), alignof(Value)));
+        }
+
+        // Sets size to the number of values in the array
+        template <typename Value>
+        Value const *readArray
+                (std::size_t &size)
+        {
+            static_assert(std::is_trivially_copyable_v<Value>);
+
+            auto const storedSize = read<std::uint64_t>();
+
+            if (storedSize > (this->size - offset) / sizeof(Value))
+                throw std::runtime_error("Truncated index file");
+
+            size = static_cast<std::size_t>(storedSize);
+
+            return static_cast<Value const *>
+                    (readBytes(size * sizeof(Value), arrayAlignment));
+        }
+
+        Eigen::Map<Eigen::MatrixXd const> readMatrix
+                ();
+
+    private:
+        //============================================================ | Data <<
+        unsigned char const *bytes = nullptr;
+        std::size_t size = 0;
+        std::size_t offset = 0;
+
+        // Contents of the file where it cannot be mapped
+        std::vector<std::max_align_t> buffer;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        void const *readBytes
+                (std::size_t size,
+                 std::size_t alignment);
+
+        void unmap
+                ();
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_INDEX_FILE_HPP
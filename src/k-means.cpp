@@ -0,0 +1,248 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "k-means.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////// | Using declarations
+template <typename Scalar>
+using Matrix = Eigen::MatrixX<Scalar>;
+
+template <typename Scalar>
+using Vector = Eigen::VectorX<Scalar>;
+
+template <typename Scalar>
+using MatrixReference = Eigen::Ref<Eigen::MatrixX<Scalar> const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////////////////////////// | Class: BasicKMeans <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    template <typename Scalar>
+    BasicKMeans<Scalar>::BasicKMeans
+            (int const numberOfClusters,
+             int const maximumNumberOfIterations,
+             int const numberOfThreads)
+            :
+            numberOfClusters { std::max(1, numberOfClusters) },
+            maximumNumberOfIterations { maximumNumberOfIterations },
+            numberOfThreads { std::max(1, numberOfThreads) }
+    {
+    }
+
+    //--------------------------------------------------------------- | Main <<<
+    template <typename Scalar>
+    Matrix<Scalar> BasicKMeans<Scalar>::cluster
+            (MatrixReference<Scalar> const &points) const
+    {
+        std::unique_ptr<ThreadPool> threadPool;
+
+        if (numberOfThreads > 1)
+            threadPool = std::make_unique<ThreadPool>(numberOfThreads);
+
+        std::mt19937 generator(static_cast<unsigned int>(std::rand()));
+
+        assignments = Eigen::VectorXi::Constant(points.cols(), -1);
+        squaredDistances.resize(points.cols());
+
+        Matrix<Scalar> centroids = seed(points, threadPool.get(), generator);
+
+        for (int iteration = 0;
+             iteration < maximumNumberOfIterations;
+             ++iteration)
+        {
+            if (assign(points, centroids, threadPool.get()) == 0)
+                break;
+
+            Matrix<Scalar> sums
+                    = Matrix<Scalar>::Zero(points.rows(), centroids.cols());
+            Eigen::VectorXi counts
+                    = Eigen::VectorXi::Zero(centroids.cols());
+
+            for (Eigen::Index k = 0; k < points.cols(); ++k)
+            {
+                sums.col(assignments(k)) += points.col(k);
+                ++counts(assignments(k));
+            }
+
+            // Empty clusters keep their previous centroid
+            for (Eigen::Index i = 0; i < centroids.cols(); ++i)
+                if (counts(i) > 0)
+                    centroids.col(i) = sums.col(i) / Scalar(counts(i));
+        }
+
+        assign(points, centroids, threadPool.get());
+
+        return centroids;
+    }
+
+    template <typename Scalar>
+    Eigen::VectorXi const &BasicKMeans<Scalar>::getAssignments
+            () const
+    {
+        return assignments;
+    }
+
+    template <typename Scalar>
+    Vector<Scalar> const &BasicKMeans<Scalar>::getSquaredDistances
+            () const
+    {
+        return squaredDistances;
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    template <typename Scalar>
+    Matrix<Scalar> BasicKMeans<Scalar>::seed
+            (MatrixReference<Scalar> const &points,
+             ThreadPool *const threadPool,
+             std::mt19937 &generator) const
+    {
+        Eigen::Index const numberOfCentroids
+                = std::min<Eigen::Index>(numberOfClusters, points.cols());
+
+        Matrix<Scalar> centroids { points.rows(), numberOfCentroids };
+
+        if (numberOfCentroids == 0)
+            return centroids;
+
+        std::uniform_int_distribution<Eigen::Index> uniformPoint
+                { 0, points.cols() - 1 };
+
+        centroids.col(0) = points.col(uniformPoint(generator));
+        squaredDistances
+                = (points.colwise() - centroids.col(0)).colwise().squaredNorm()
+                        .transpose();
+
+        for (Eigen::Index i = 1; i < numberOfCentroids; ++i)
+        {
+            // Next centroid drawn with probability proportional to the
+            // squared distance to the nearest centroid so far
+            double const total = squaredDistances.template cast<double>().sum();
+            Eigen::Index chosen = uniformPoint(generator);
+
+            if (total > 0.0)
+            {
+                double threshold = std::uniform_real_distribution<double>
+                        { 0.0, total }(generator);
+
+                for (chosen = 0; chosen < points.cols() - 1; ++chosen)
+                {
+                    threshold -= squaredDistances(chosen);
+
+                    if (threshold < 0.0)
+                        break;
+                }
+            }
+
+            centroids.col(i) = points.col(chosen);
+
+            forEachSlice(points.cols(),
+                         threadPool,
+                         [&](int, Eigen::Index const begin,
+                             Eigen::Index const end)
+                         {
+                             auto const slice
+                                     = points.middleCols(begin, end - begin);
+
+                             squaredDistances.segment(begin, end - begin)
+                                     = squaredDistances
+                                             .segment(begin, end - begin)
+                                             .cwiseMin
+                                                     ((slice.colwise()
+                                                       - centroids.col(i))
+                                                              .colwise()
+                                                              .squaredNorm()
+                                                              .transpose());
+                         });
+        }
+
+        return centroids;
+    }
+
+    template <typename Scalar>
+    int BasicKMeans<Scalar>::assign
+            (MatrixReference<Scalar> const &points,
+             Matrix<Scalar> const &centroids,
+             ThreadPool *const threadPool) const
+    {
+        Vector<Scalar> const centroidsSquaredNorms
+                = centroids.colwise().squaredNorm().transpose();
+
+        std::vector<int> changesPerSlice(numberOfThreads, 0);
+
+        forEachSlice(points.cols(),
+                     threadPool,
+                     [&](int const slice,
+                         Eigen::Index const begin,
+                         Eigen::Index const end)
+                     {
+                         // ||x - c||^2 = ||x||^2 - 2 c.x + ||c||^2 for all
+                         // centroids and points of the slice at once
+                         auto const slicePoints
+                                 = points.middleCols(begin, end - begin);
+
+                         Matrix<Scalar> distances
+                                 = Scalar(-2)
+                                   * centroids.transpose() * slicePoints;
+                         distances.colwise() += centroidsSquaredNorms;
+
+                         for (Eigen::Index k = 0; k < distances.cols(); ++k)
+                         {
+                             Eigen::Index nearest;
+                             Scalar const distance
+                                     = distances.col(k).minCoeff(&nearest);
+
+                             if (assignments(begin + k) != nearest)
+                             {
+                                 assignments(begin + k)
+                                         = static_cast<int>(nearest);
+                                 ++changesPerSlice[slice];
+                             }
+
+                             squaredDistances(begin + k)
+                                     = std::max(Scalar(0),
+                                                distance
+                                                + slicePoints.col(k)
+                                                        .squaredNorm());
+                         }
+                     });
+
+        int changes = 0;
+        for (int const changesInSlice : changesPerSlice)
+            changes += changesInSlice;
+
+        return changes;
+    }
+
+    template <typename Scalar>
+    void BasicKMeans<Scalar>::forEachSlice
+            (Eigen::Index const numberOfPoints,
+             ThreadPool *const threadPool,
+             std::function<void(int, Eigen::Index, Eigen::Index)> const &
+             function) const
+    {
+        auto const slice
+                = [&](int const i)
+                  {
+                      function(i,
+                               numberOfPoints * i / numberOfThreads,
+                               numberOfPoints * (i + 1) / numberOfThreads);
+                  };
+
+        if (threadPool == nullptr)
+            for (int i = 0; i < numberOfThreads; ++i)
+                slice(i);
+        else
+            threadPool->parallelFor(numberOfThreads, slice);
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicKMeans<float>;
+    template class BasicKMeans<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,76 @@
+#ifndef IAD_2A_K_MEANS_HPP
+#define IAD_2A_K_MEANS_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "thread-pool.hpp"
+
+#include <Eigen/Eigen>
+#include <functional>
+#include <random>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////////////////////////// | Class: BasicKMeans <
+    // Lloyd's algorithm seeded with k-means++. Distances of every point to the
+    // centroids come from one matrix product per slice of points, and slices
+    // are spread over a thread pool.
+    template <typename Scalar>
+    class BasicKMeans final
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        explicit BasicKMeans
+                (int numberOfClusters,
+                 int maximumNumberOfIterations = 100,
+                 int numberOfThreads = 1);
+
+        //----------------------------------------------------------- | Main <<<
+        // Takes one point per column and returns one centroid per column.
+        // Seeds come from rand(), so they follow the layers' generators.
+        Eigen::MatrixX<Scalar> cluster
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &points) const;
+
+        // Index of the nearest centroid of every point and its squared
+        // distance, as left by the last call to cluster
+        Eigen::VectorXi const &getAssignments
+                () const;
+
+        Eigen::VectorX<Scalar> const &getSquaredDistances
+                () const;
+
+    private:
+        //============================================================ | Data <<
+        int numberOfClusters;
+        int maximumNumberOfIterations;
+        int numberOfThreads;
+
+        Eigen::VectorXi mutable assignments;
+        Eigen::VectorX<Scalar> mutable squaredDistances;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        Eigen::MatrixX<Scalar> seed
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &points,
+                 ThreadPool *threadPool,
+                 std::mt19937 &generator) const;
+
+        // Returns the number of points whose nearest centroid changed
+        int assign
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &points,
+                 Eigen::MatrixX<Scalar> const &centroids,
+                 ThreadPool *threadPool) const;
+
+        void forEachSlice
+                (Eigen::Index numberOfPoints,
+                 ThreadPool *threadPool,
+                 std::function<void(int, Eigen::Index, Eigen::Index)> const &
+                 function) const;
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using KMeans = BasicKMeans<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_K_MEANS_HPP
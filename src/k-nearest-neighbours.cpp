@@ -3,106 +3,538 @@
 //
 
 #include "k-nearest-neighbours.hpp"
+#include "activation-kernels.hpp"
+#include <algorithm>
 #include <map>
 #include <functional>
-#include <iostream>
+#include <numeric>
 
+using Matrix = Eigen::MatrixXd;
 using Vector = Eigen::VectorXd;
+using MatrixReference = Eigen::Ref<Eigen::MatrixXd const>;
 
 namespace NeuralNetworks
 {
+    namespace
+    {
+        template <typename Scalar>
+        Eigen::Map<Eigen::VectorX<Scalar> const> readVector
+                (MappedIndexFile &file,
+                 Eigen::Index const size)
+        {
+            std::size_t storedSize;
+            Scalar const *const data = file.readArray<Scalar>(storedSize);
+
+            if (storedSize != static_cast<std::size_t>(size))
+                throw std::runtime_error("Corrupt index file");
+
+            return { data, size };
+        }
+    }
+
     KNearestNeighbours::KNearestNeighbours
             (int const k,
-             std::vector<TrainingExample> const &examples)
+             std::vector<TrainingExample> const &examples,
+             SearchIndex const searchIndex,
+             int const leafSize,
+             int const numberOfLinks,
+             int const constructionBreadth)
             :
             k { k },
-            examples { examples },
-            distances { examples.size() }
+            searchIndex { searchIndex },
+            ownedInputs(examples.empty() ? 0 : examples.front().inputs.size(),
+                        examples.size()),
+            ownedOutputs(examples.empty() ? 0 : examples.front().outputs.size(),
+                         examples.size()),
+            ownedInputsSquaredNorms(examples.size()),
+            ownedSegmentOrder(ownedInputs.rows() / segmentSize),
+            inputs { ownedInputs.data(),
+                     ownedInputs.rows(),
+                     ownedInputs.cols() },
+            outputs { ownedOutputs.data(),
+                      ownedOutputs.rows(),
+                      ownedOutputs.cols() },
+            inputsSquaredNorms { ownedInputsSquaredNorms.data(),
+                                 ownedInputsSquaredNorms.size() },
+            segmentOrder { ownedSegmentOrder.data(),
+                           ownedSegmentOrder.size() }
     {
+        for (std::size_t i = 0; i < examples.size(); ++i)
+        {
+            ownedInputs.col(i) = examples[i].inputs;
+            ownedOutputs.col(i) = examples[i].outputs;
+        }
+
+        buildSearchIndex(leafSize, numberOfLinks, constructionBreadth);
     }
 
-    using iksde = std::pair<double, TrainingExample const *>;
+    KNearestNeighbours::KNearestNeighbours
+            (int const k,
+             Eigen::Map<Matrix const> const &inputs,
+             Eigen::Map<Matrix const> const &outputs,
+             SearchIndex const searchIndex,
+             int const leafSize,
+             int const numberOfLinks,
+             int const constructionBreadth)
+            :
+            k { k },
+            searchIndex { searchIndex },
+            ownedInputsSquaredNorms(inputs.cols()),
+            ownedSegmentOrder(inputs.rows() / segmentSize),
+            inputs { inputs },
+            outputs { outputs },
+            inputsSquaredNorms { ownedInputsSquaredNorms.data(),
+                                 ownedInputsSquaredNorms.size() },
+            segmentOrder { ownedSegmentOrder.data(),
+                           ownedSegmentOrder.size() }
+    {
+        buildSearchIndex(leafSize, numberOfLinks, constructionBreadth);
+    }
+
+    KNearestNeighbours::KNearestNeighbours
+            (std::string const &filename)
+            :
+            KNearestNeighbours { std::make_shared<MappedIndexFile>(filename) }
+    {
+    }
+
+    KNearestNeighbours::KNearestNeighbours
+            (std::shared_ptr<MappedIndexFile> const &file)
+            :
+            k { file->read<int>() },
+            searchIndex { file->read<SearchIndex>() },
+            inputs { file->readMatrix() },
+            outputs { file->readMatrix() },
+            inputsSquaredNorms { readVector<double>(*file, inputs.cols()) },
+            segmentOrder { readVector<int>(*file,
+                                           inputs.rows() / segmentSize) },
+            kdTree { searchIndex == SearchIndex::KdTree
+                     ? KdTree { *file }
+                     : KdTree {} },
+            ballTree { searchIndex == SearchIndex::BallTree
+                       ? BallTree { *file }
+                       : BallTree {} },
+            hnswGraph { searchIndex == SearchIndex::HnswGraph
+                        ? HnswGraph { *file }
+                        : HnswGraph {} },
+            searchBreadth { file->read<int>() },
+            mappedFile { file }
+    {
+    }
 
     Vector KNearestNeighbours::operator()
             (Vector const &inputs) const
     {
-        static auto const comparator
-                = [](iksde const &a, iksde const &b) -> bool
-                {
-                    return a.first < b.first;
-                };
-
-        // Compute distances
-        for (auto[example, distance, examplesCEnd]
-             = std::make_tuple(examples.cbegin(),
-                               distances.begin(),
-                               examples.cend());
-             example != examplesCEnd;
-             ++example, ++distance)
+        std::vector<int> &nearest = threadWorkspace().nearest;
+        findNearest(inputs, nearest);
+
+        // Average the outputs
+        Vector sumOfKTargets { outputs.col(nearest.front()) };
+        for (std::size_t i = 1; i < nearest.size(); ++i)
         {
-            distance->first = (example->inputs - inputs).norm();
-            distance->second = &(*example);
+            sumOfKTargets.noalias() += outputs.col(nearest[i]);
         }
 
-        // Sort distances
-        std::sort(distances.begin(),
-                  distances.end(),
-                  comparator);
+        return sumOfKTargets / nearest.size();
+    }
+
+    void KNearestNeighbours::findNearest
+            (Vector const &inputs,
+             std::vector<int> &indices) const
+    {
+        auto &[neighbours, nearest, squaredDistances, graphScratch]
+                = threadWorkspace();
+
+        indices.clear();
+        neighbours.clear(k);
+
+        if (searchIndex == SearchIndex::KdTree)
+            kdTree.findNearest(this->inputs, inputs, neighbours);
+        else if (searchIndex == SearchIndex::BallTree)
+            ballTree.findNearest(this->inputs, inputs, neighbours);
+        else if (searchIndex == SearchIndex::HnswGraph)
+            hnswGraph.findNearest(this->inputs,
+                                  inputs,
+                                  neighbours,
+                                  std::max(searchBreadth, k),
+                                  graphScratch);
+        else
+            searchExhaustively(inputs, neighbours, squaredDistances);
+
+        for (auto const &[squaredDistance, index]
+                : neighbours.sort())
+            indices.push_back(index);
+    }
+
+    Matrix KNearestNeighbours::calculateOutputsBatch
+            (MatrixReference const &inputs) const
+    {
+        Eigen::MatrixXi indices;
+        findNearestBatch(inputs, indices);
+
+        Matrix outputs = Matrix::Zero(this->outputs.rows(), inputs.cols());
 
         // Average the outputs
-        Vector sumOfKTargets { distances.cbegin()->second->outputs };
-        for (auto[i, distance]= std::make_tuple(k - 1,
-                                                distances.cbegin() + 1);
-             i--;
-             ++distance)
+        for (Eigen::Index j = 0; j < indices.cols(); ++j)
+        {
+            for (Eigen::Index i = 0; i < indices.rows(); ++i)
+                outputs.col(j) += this->outputs.col(indices(i, j));
+
+            outputs.col(j) /= indices.rows();
+        }
+
+        return outputs;
+    }
+
+    void KNearestNeighbours::findNearestBatch
+            (MatrixReference const &inputs,
+             Eigen::MatrixXi &indices) const
+    {
+        indices.resize(std::min<Eigen::Index>(k, this->inputs.cols()),
+                       inputs.cols());
+
+        if (searchIndex != SearchIndex::BruteForce)
+        {
+            std::vector<int> nearest;
+
+            for (Eigen::Index j = 0; j < inputs.cols(); ++j)
+            {
+                findNearest(inputs.col(j), nearest);
+
+                for (Eigen::Index i = 0; i < indices.rows(); ++i)
+                    indices(i, j) = nearest[i];
+            }
+
+            return;
+        }
+
+        findExactlyNearestBatch(inputs, indices);
+    }
+
+    void KNearestNeighbours::findExactlyNearestBatch
+            (MatrixReference const &inputs,
+             Eigen::MatrixXi &indices) const
+    {
+        indices.resize(std::min<Eigen::Index>(k, this->inputs.cols()),
+                       inputs.cols());
+
+        std::vector<NeighbourHeap> neighbours(queryBlockSize);
+        Matrix squaredDistances { exampleBlockSize, queryBlockSize };
+
+        for (Eigen::Index first = 0;
+             first < inputs.cols();
+             first += queryBlockSize)
+        {
+            auto const numberOfQueries
+                    = std::min<Eigen::Index>(queryBlockSize,
+                                             inputs.cols() - first);
+
+            searchExhaustivelyBatch(inputs.middleCols(first, numberOfQueries),
+                                    neighbours,
+                                    squaredDistances);
+
+            for (Eigen::Index j = 0; j < numberOfQueries; ++j)
+            {
+                auto const &sortedNeighbours = neighbours[j].sort();
+
+                for (Eigen::Index i = 0; i < indices.rows(); ++i)
+                    indices(i, first + j) = sortedNeighbours[i].second;
+            }
+        }
+    }
+
+    KNearestNeighbours::SearchIndex KNearestNeighbours::getSearchIndex
+            () const
+    {
+        return searchIndex;
+    }
+
+    void KNearestNeighbours::setSearchBreadth
+            (int const searchBreadth)
+    {
+        this->searchBreadth = searchBreadth;
+    }
+
+    int KNearestNeighbours::getSearchBreadth
+            () const
+    {
+        return searchBreadth;
+    }
+
+    double KNearestNeighbours::measureRecall
+            (MatrixReference const &inputs) const
+    {
+        Eigen::MatrixXi found, exact;
+        findNearestBatch(inputs, found);
+        findExactlyNearestBatch(inputs, exact);
+
+        if (exact.size() == 0)
+            return 1.0;
+
+        Eigen::Index numberOfFound = 0;
+
+        for (Eigen::Index j = 0; j < exact.cols(); ++j)
         {
-            sumOfKTargets.noalias() += distance->second->outputs;
+            std::sort(found.col(j).data(), found.col(j).data() + found.rows());
+
+            for (Eigen::Index i = 0; i < exact.rows(); ++i)
+                numberOfFound += std::binary_search
+                        (found.col(j).data(),
+                         found.col(j).data() + found.rows(),
+                         exact(i, j));
         }
 
-        return sumOfKTargets / k;
+        return double(numberOfFound) / double(exact.size());
+    }
+
+    void KNearestNeighbours::saveToFile
+            (std::string const &filename) const
+    {
+        // In the order the members are read back
+        IndexFileWriter file { filename };
+
+        file.write(k);
+        file.write(searchIndex);
+        file.writeMatrix(inputs);
+        file.writeMatrix(outputs);
+        file.writeArray(inputsSquaredNorms.data(), inputsSquaredNorms.size());
+        file.writeArray(segmentOrder.data(), segmentOrder.size());
+
+        if (searchIndex == SearchIndex::KdTree)
+            kdTree.writeToFile(file);
+        else if (searchIndex == SearchIndex::BallTree)
+            ballTree.writeToFile(file);
+        else if (searchIndex == SearchIndex::HnswGraph)
+            hnswGraph.writeToFile(file);
+
+        file.write(searchBreadth);
+        file.close();
+    }
+
+    void KNearestNeighbours::buildSearchIndex
+            (int const leafSize,
+             int const numberOfLinks,
+             int const constructionBreadth)
+    {
+        // Same sizes as before, so the maps stay valid
+        ownedInputsSquaredNorms = inputs.colwise().squaredNorm().transpose();
+
+        // Segments of dimensions that spread the examples most come first,
+        // as they add most to the distances of far examples
+        if (inputs.cols() > 0)
+        {
+            Vector const means = inputs.rowwise().mean();
+            Vector const variances
+                    = inputs.rowwise().squaredNorm() / double(inputs.cols())
+                      - means.cwiseAbs2();
+
+            Vector segmentVariances(ownedSegmentOrder.size());
+            for (Eigen::Index s = 0; s < segmentVariances.size(); ++s)
+                segmentVariances(s)
+                        = variances.segment(s * segmentSize, segmentSize).sum();
+
+            std::iota(ownedSegmentOrder.begin(), ownedSegmentOrder.end(), 0);
+            std::stable_sort(ownedSegmentOrder.begin(),
+                             ownedSegmentOrder.end(),
+                             [&segmentVariances](int const a, int const b)
+                             {
+                                 return segmentVariances(a)
+                                        > segmentVariances(b);
+                             });
+        }
+        else
+        {
+            std::iota(ownedSegmentOrder.begin(), ownedSegmentOrder.end(), 0);
+        }
+
+        if (inputs.cols() == 0)
+            searchIndex = SearchIndex::BruteForce;
+
+        if (searchIndex == SearchIndex::Automatic)
+            searchIndex = inputs.rows() <= kdTreeMaximumNumberOfDimensions
+                          ? SearchIndex::KdTree
+                          : SearchIndex::BallTree;
+
+        if (searchIndex == SearchIndex::KdTree)
+            kdTree = KdTree { inputs, leafSize };
+        else if (searchIndex == SearchIndex::BallTree)
+            ballTree = BallTree { inputs, leafSize };
+        else if (searchIndex == SearchIndex::HnswGraph)
+            hnswGraph = HnswGraph { inputs,
+                                    numberOfLinks,
+                                    constructionBreadth };
+    }
+
+    KNearestNeighbours::Workspace &KNearestNeighbours::threadWorkspace
+            ()
+    {
+        thread_local Workspace workspace
+                { NeighbourHeap {}, {}, Vector(blockSize), {} };
+
+        return workspace;
+    }
+
+    void KNearestNeighbours::searchExhaustively
+            (Vector const &inputs,
+             NeighbourHeap &neighbours,
+             Vector &squaredDistances) const
+    {
+        // Squared distances of a block of examples at a time, streamed
+        // through the heap, which keeps only the k nearest
+        for (Eigen::Index first = 0;
+             first < this->inputs.cols();
+             first += blockSize)
+        {
+            auto const numberOfExamples
+                    = std::min<Eigen::Index>(blockSize,
+                                             this->inputs.cols() - first);
+
+            // Examples farther than the k-th nearest so far are abandoned
+            // part way through their distance
+            ActivationKernels::boundedSquaredDistances
+                    (this->inputs.col(first).data(),
+                     this->inputs.rows(),
+                     numberOfExamples,
+                     inputs.data(),
+                     segmentOrder.data(),
+                     segmentOrder.size(),
+                     segmentSize,
+                     neighbours.bound(),
+                     squaredDistances.data());
+
+            for (Eigen::Index i = 0; i < numberOfExamples; ++i)
+                if (squaredDistances(i) < neighbours.bound())
+                    neighbours.push(squaredDistances(i),
+                                    static_cast<int>(first + i));
+        }
+    }
+
+    void KNearestNeighbours::searchExhaustivelyBatch
+            (MatrixReference const &inputs,
+             std::vector<NeighbourHeap> &neighbours,
+             Matrix &squaredDistances) const
+    {
+        Vector const queriesSquaredNorms
+                = inputs.colwise().squaredNorm().transpose();
+
+        for (Eigen::Index j = 0; j < inputs.cols(); ++j)
+            neighbours[j].clear(k);
+
+        // One block of examples against all queries at a time, so that the
+        // block stays in cache while the product reuses it for every query
+        for (Eigen::Index first = 0;
+             first < this->inputs.cols();
+             first += exampleBlockSize)
+        {
+            auto const numberOfExamples
+                    = std::min<Eigen::Index>(exampleBlockSize,
+                                             this->inputs.cols() - first);
+
+            auto block = squaredDistances.topLeftCorner(numberOfExamples,
+                                                        inputs.cols());
+
+            block.noalias()
+                    = -2.0
+                      * this->inputs.middleCols(first, numberOfExamples)
+                              .transpose()
+                      * inputs;
+
+            for (Eigen::Index j = 0; j < inputs.cols(); ++j)
+                for (Eigen::Index i = 0; i < numberOfExamples; ++i)
+                {
+                    // Rounding may leave tiny negative distances
+                    double const squaredDistance
+                            = std::max(0.0,
+                                       block(i, j)
+                                       + inputsSquaredNorms(first + i)
+                                       + queriesSquaredNorms(j));
+
+                    if (squaredDistance < neighbours[j].bound())
+                        neighbours[j].push(squaredDistance,
+                                           static_cast<int>(first + i));
+                }
+        }
     }
 
     KNearestNeighbours::TestingResults KNearestNeighbours::test
-            (std::vector<TrainingExample> const &testingExamples) const
+            (std::vector<TrainingExample> const &testingExamples,
+             int const numberOfThreads) const
     {
         // Prepare results
         TestingResults testingResults;
         testingResults.globalCost = 0.0;
+        testingResults.testingResultsPerExample.resize
+                (testingExamples.size());
 
-        int currentExampleNumber = 1;
+        int const numberOfBatches
+                = static_cast<int>((testingExamples.size()
+                                    + testingBatchSize - 1)
+                                   / testingBatchSize);
 
-        // Test the network
-        for (auto const &testingExample
-                : testingExamples)
-        {
-            std::cout << "example: " << currentExampleNumber++ << "\r";
+        std::vector<double> costPerBatch(numberOfBatches, 0.0);
 
-            auto const &inputs
-                    = testingExample.inputs;
+        // Test in batches, so that queries share their distance
+        // computations; every batch writes only its own results
+        auto const testBatch
+                = [&](int const batch)
+                  {
+                      std::size_t const first
+                              = std::size_t(batch) * testingBatchSize;
+                      std::size_t const batchSize
+                              = std::min<std::size_t>
+                                      (testingBatchSize,
+                                       testingExamples.size() - first);
 
-            Vector const outputs
-                    = this->operator()(inputs);
+                      Matrix batchInputs
+                              { testingExamples[first].inputs.size(),
+                                static_cast<Eigen::Index>(batchSize) };
+                      for (std::size_t j = 0; j < batchSize; ++j)
+                          batchInputs.col(j)
+                                  = testingExamples[first + j].inputs;
 
-            std::vector<Vector> neurons
-                    { inputs, outputs };
+                      Matrix const batchOutputs
+                              = calculateOutputsBatch(batchInputs);
 
-            auto const &targets
-                    = testingExample.outputs;
+                      for (std::size_t j = 0; j < batchSize; ++j)
+                      {
+                          auto const &inputs
+                                  = testingExamples[first + j].inputs;
 
-            auto const errors
-                    = targets - outputs;
+                          Vector const outputs
+                                  = batchOutputs.col(j);
 
-            // Calculate cost
-            double cost = errors.array().square().sum();
-            testingResults.globalCost += cost;
+                          std::vector<Vector> neurons
+                                  { inputs, outputs };
 
-            // Save testing results per example
-            testingResults.testingResultsPerExample.push_back
-                    ({ neurons,
-                       targets,
-                       errors,
-                       cost });
-        }
+                          auto const &targets
+                                  = testingExamples[first + j].outputs;
+
+                          auto const errors
+                                  = targets - outputs;
+
+                          // Calculate cost
+                          double cost = errors.array().square().sum();
+                          costPerBatch[batch] += cost;
+
+                          // Save testing results per example
+                          testingResults.testingResultsPerExample
+                                  [first + j]
+                                  = { neurons,
+                                      targets,
+                                      errors,
+                                      cost };
+                      }
+                  };
+
+        if (numberOfThreads > 1 && numberOfBatches > 1)
+            ThreadPool { std::min(numberOfThreads, numberOfBatches) }
+                    .parallelFor(numberOfBatches, testBatch);
+        else
+            for (int batch = 0; batch < numberOfBatches; ++batch)
+                testBatch(batch);
+
+        for (double const cost : costPerBatch)
+            testingResults.globalCost += cost;
 
         // Average out global error
         testingResults.globalCost /= testingExamples.size();
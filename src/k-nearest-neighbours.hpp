@@ -2,6 +2,14 @@
 #define IAD_2A_K_NEAREST_NEIGHBOURS_HPP
 
 #include "training-example.hpp"
+#include "kd-tree.hpp"
+#include "ball-tree.hpp"
+#include "hnsw-graph.hpp"
+#include "index-file.hpp"
+#include "neighbour-heap.hpp"
+#include "thread-pool.hpp"
+#include <memory>
+#include <string>
 #include <vector>
 #include <Eigen/Eigen>
 
@@ -13,22 +21,184 @@ namespace NeuralNetworks
         struct TestingResults;
         struct TestingResultsPerExample;
 
+        // Exact search through a tree built in the constructor, or through
+        // every example. Kd-trees suit few dimensions, ball trees many.
+        // The HNSW graph trades exactness for speed on many dimensions;
+        // Automatic never selects it.
+        enum class SearchIndex
+        {
+            Automatic,
+            BruteForce,
+            KdTree,
+            BallTree,
+            HnswGraph
+        };
+
+        // Queries are re-entrant: every thread searches with its own
+        // scratch buffers, so one object may serve many threads at once.
+        // The leaf size applies to trees, the numbers of links and the
+        // construction breadth to the HNSW graph.
         KNearestNeighbours
                 (int const k,
-                 std::vector<TrainingExample> const &examples);
+                 std::vector<TrainingExample> const &examples,
+                 SearchIndex searchIndex = SearchIndex::Automatic,
+                 int leafSize = 32,
+                 int numberOfLinks = 16,
+                 int constructionBreadth = 200);
+
+        // Borrows the examples instead of copying them, one example per
+        // column of inputs and outputs. The buffers have to outlive the
+        // object and stay unchanged.
+        KNearestNeighbours
+                (int const k,
+                 Eigen::Map<Eigen::MatrixXd const> const &inputs,
+                 Eigen::Map<Eigen::MatrixXd const> const &outputs,
+                 SearchIndex searchIndex = SearchIndex::Automatic,
+                 int leafSize = 32,
+                 int numberOfLinks = 16,
+                 int constructionBreadth = 200);
+
+        // Maps a model written by saveToFile, index included. Queries read
+        // the file's pages as they need them, so nothing is rebuilt.
+        explicit KNearestNeighbours
+                (std::string const &filename);
+
+        // Copies would borrow the original's storage
+        KNearestNeighbours
+                (KNearestNeighbours const &) = delete;
+
+        KNearestNeighbours
+                (KNearestNeighbours &&) = default;
 
         Eigen::VectorXd operator()
                 (Eigen::VectorXd const &inputs) const;
 
+        // Replaces the contents of indices with the k nearest examples,
+        // from the nearest
+        void findNearest
+                (Eigen::VectorXd const &inputs,
+                 std::vector<int> &indices) const;
+
+        // Batch counterparts taking one query per column. Column j of
+        // indices gets the nearest examples of query j, from the nearest.
+        // Brute-force search gets the squared distances of whole blocks of
+        // queries and examples as ||q||^2 - 2 Q^T R + ||r||^2, through one
+        // matrix product per block.
+        Eigen::MatrixXd calculateOutputsBatch
+                (Eigen::Ref<Eigen::MatrixXd const> const &inputs) const;
+
+        void findNearestBatch
+                (Eigen::Ref<Eigen::MatrixXd const> const &inputs,
+                 Eigen::MatrixXi &indices) const;
+
+        SearchIndex getSearchIndex
+                () const;
+
+        // Candidates kept by HNSW graph searches, at least k. Wider searches
+        // are slower and find more of the exact nearest neighbours.
+        void setSearchBreadth
+                (int searchBreadth);
+
+        int getSearchBreadth
+                () const;
+
+        // Fraction of the exact k nearest neighbours, found by brute force,
+        // that the selected search finds for the queries, one per column
+        double measureRecall
+                (Eigen::Ref<Eigen::MatrixXd const> const &inputs) const;
+
+        // Batches of testing examples are spread over a thread pool.
+        // Results keep the order of the examples and the global cost is
+        // summed in that order, whatever the number of threads.
         TestingResults test
-                (std::vector<TrainingExample> const &testingExamples) const;
+                (std::vector<TrainingExample> const &testingExamples,
+                 int numberOfThreads = 1) const;
+
+        // Writes the examples and the index in the flat layout of
+        // IndexFileWriter, ready to be mapped
+        void saveToFile
+                (std::string const &filename) const;
 
 
     private:
+        // Scratch buffers of single queries, one set per thread
+        struct Workspace
+        {
+            NeighbourHeap neighbours;
+            std::vector<int> nearest;
+            Eigen::VectorXd squaredDistances;
+            HnswGraph::Scratch graphScratch;
+        };
+
+        // Automatic search uses a kd-tree up to this many dimensions
+        static constexpr int kdTreeMaximumNumberOfDimensions = 16;
+
+        // Examples per call to the distance kernel in brute-force search
+        static constexpr int blockSize = 256;
+
+        // Dimensions summed between checks against the k-th nearest
+        // distance in brute-force search
+        static constexpr int segmentSize = 32;
+
+        // Queries and examples per matrix product in batch search
+        static constexpr int queryBlockSize = 64;
+        static constexpr int exampleBlockSize = 512;
+
+        // Testing examples per batch query
+        static constexpr int testingBatchSize = 256;
+
         int const k;
-        std::vector<TrainingExample> const examples;
-        std::vector<std::pair<double, TrainingExample const *>>
-        mutable distances;
+
+        SearchIndex searchIndex;
+
+        // Examples copied in the constructor, empty when they are borrowed
+        // or mapped
+        Eigen::MatrixXd ownedInputs, ownedOutputs;
+        Eigen::VectorXd ownedInputsSquaredNorms;
+        Eigen::VectorXi ownedSegmentOrder;
+
+        // Inputs and outputs of the examples, one per column, owned,
+        // borrowed or mapped. Searches stream the inputs and the indices
+        // refer to their columns.
+        Eigen::Map<Eigen::MatrixXd const> inputs, outputs;
+        Eigen::Map<Eigen::VectorXd const> inputsSquaredNorms;
+
+        // Whole segments of segmentSize dimensions, by decreasing variance
+        // of the inputs. Brute-force search sums distances in this order.
+        Eigen::Map<Eigen::VectorXi const> segmentOrder;
+        KdTree kdTree;
+        BallTree ballTree;
+        HnswGraph hnswGraph;
+        int searchBreadth = 64;
+
+        // File the maps point into, if any
+        std::shared_ptr<MappedIndexFile const> mappedFile;
+
+        // Reads the members from the file in the order they are declared
+        explicit KNearestNeighbours
+                (std::shared_ptr<MappedIndexFile> const &file);
+
+        void buildSearchIndex
+                (int leafSize,
+                 int numberOfLinks,
+                 int constructionBreadth);
+
+        static Workspace &threadWorkspace
+                ();
+
+        void searchExhaustively
+                (Eigen::VectorXd const &inputs,
+                 NeighbourHeap &neighbours,
+                 Eigen::VectorXd &squaredDistances) const;
+
+        void findExactlyNearestBatch
+                (Eigen::Ref<Eigen::MatrixXd const> const &inputs,
+                 Eigen::MatrixXi &indices) const;
+
+        void searchExhaustivelyBatch
+                (Eigen::Ref<Eigen::MatrixXd const> const &inputs,
+                 std::vector<NeighbourHeap> &neighbours,
+                 Eigen::MatrixXd &squaredDistances) const;
     };
 
     //------------------------------------------ | Structure: TestingResults <<<
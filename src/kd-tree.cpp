@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "kd-tree.hpp"
+#include "bounding-boxes.hpp"
+
+/////////////////////////////////////////////////////////// | Using declarations
+using VectorMap = Eigen::Map<Eigen::VectorXd const>;
+using MatrixReference = Eigen::Ref<Eigen::MatrixXd const>;
+using VectorReference = Eigen::Ref<Eigen::VectorXd const>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////////////////////// | Class: KdTree <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    KdTree::KdTree
+            (MatrixReference const &points,
+             int const leafSize)
+            :
+            tree { static_cast<int>(points.rows()),
+                   static_cast<int>(points.cols()),
+                   leafSize }
+    {
+        ownedLowerBounds.resize(points.rows(), tree.maximumNumberOfNodes());
+        ownedUpperBounds.resize(points.rows(), tree.maximumNumberOfNodes());
+
+        // Median of the widest dimension of the node's box
+        tree.build([this, &points](Node &node, int const index)
+                   {
+                       BoundingBoxes::calculate(points,
+                                                tree.getOrder(),
+                                                node.begin,
+                                                node.end,
+                                                index,
+                                                ownedLowerBounds,
+                                                ownedUpperBounds);
+                   },
+                   [this, &points](Node const &, int const index)
+                   {
+                       Eigen::Index const dimension
+                               = BoundingBoxes::widestDimension
+                                       (ownedLowerBounds.col(index),
+                                        ownedUpperBounds.col(index));
+
+                       return [&points, dimension](int const point)
+                       {
+                           return points(dimension, point);
+                       };
+                   });
+
+        ownedLowerBounds.conservativeResize(Eigen::NoChange,
+                                            tree.getNumberOfNodes());
+        ownedUpperBounds.conservativeResize(Eigen::NoChange,
+                                            tree.getNumberOfNodes());
+
+        lowerBounds = ownedLowerBounds.data();
+        upperBounds = ownedUpperBounds.data();
+    }
+
+    KdTree::KdTree
+            (MappedIndexFile &file)
+            :
+            tree { file }
+    {
+        lowerBounds = tree.readBounds(file);
+        upperBounds = tree.readBounds(file);
+    }
+
+    //--------------------------------------------------------------- | Main <<<
+    void KdTree::findNearest
+            (MatrixReference const &points,
+             VectorReference const &query,
+             NeighbourHeap &neighbours) const
+    {
+        tree.findNearest(points,
+                         query,
+                         neighbours,
+                         [this, &query](int const node)
+                         {
+                             return squaredDistanceToBox(node, query);
+                         });
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    bool KdTree::isEmpty
+            () const
+    {
+        return tree.isEmpty();
+    }
+
+    //------------------------------------------------------ | Serialization <<<
+    void KdTree::writeToFile
+            (IndexFileWriter &file) const
+    {
+        tree.writeToFile(file);
+        tree.writeBounds(file, lowerBounds);
+        tree.writeBounds(file, upperBounds);
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    double KdTree::squaredDistanceToBox
+            (int const node,
+             VectorReference const &query) const
+    {
+        int const numberOfDimensions = tree.getNumberOfDimensions();
+        auto const offset = std::size_t(node) * numberOfDimensions;
+
+        return BoundingBoxes::squaredDistance
+                (VectorMap { lowerBounds + offset, numberOfDimensions },
+                 VectorMap { upperBounds + offset, numberOfDimensions },
+                 query);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
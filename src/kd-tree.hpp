@@ -0,0 +1,93 @@
+#ifndef IAD_2A_KD_TREE_HPP
+#define IAD_2A_KD_TREE_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "index-file.hpp"
+#include "neighbour-heap.hpp"
+#include "search-tree.hpp"
+
+#include <Eigen/Eigen>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////////////////////// | Class: KdTree <
+    // Exact nearest neighbours search for points of few dimensions. Nodes
+    // split their points at the median of the widest dimension and keep
+    // their bounding box, so subtrees farther than the k-th candidate found
+    // so far are skipped. The points themselves are not stored; queries get
+    // the same matrix the tree was built from. Built trees own their arrays,
+    // trees read from an index file point into its mapping.
+    class KdTree final
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        KdTree
+                () = default;
+
+        // One point per column
+        explicit KdTree
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 int leafSize = 32);
+
+        // Maps a tree written by writeToFile, which has to outlive it
+        explicit KdTree
+                (MappedIndexFile &file);
+
+        // Copies would point into the original's arrays
+        KdTree
+                (KdTree const &) = delete;
+
+        KdTree
+                (KdTree &&) = default;
+
+        KdTree &operator=
+                (KdTree const &) = delete;
+
+        KdTree &operator=
+                (KdTree &&) = default;
+
+        //----------------------------------------------------------- | Main <<<
+        // Pushes the nearest points into neighbours, which keeps as many of
+        // them as it was cleared for
+        void findNearest
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 Eigen::Ref<Eigen::VectorXd const> const &query,
+                 NeighbourHeap &neighbours) const;
+
+        //--------------------------------------------------------- | Traits <<<
+        bool isEmpty
+                () const;
+
+        //-------------------------------------------------- | Serialization <<<
+        void writeToFile
+                (IndexFileWriter &file) const;
+
+    private:
+        //====================================================== | Structures <<
+        struct Node
+        {
+            int begin, end;
+            int left, right;
+        };
+
+        //============================================================ | Data <<
+        SearchTree<Node> tree;
+
+        // Arrays of built trees, empty in mapped ones
+        Eigen::MatrixXd ownedLowerBounds, ownedUpperBounds;
+
+        // Bounding box of every node, one node per column
+        double const *lowerBounds = nullptr;
+        double const *upperBounds = nullptr;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        double squaredDistanceToBox
+                (int node,
+                 Eigen::Ref<Eigen::VectorXd const> const &query) const;
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_KD_TREE_HPP
@@ -19,6 +19,7 @@
 
 using namespace std;
 using namespace NeuralNetworks;
+using Matrix = Eigen::MatrixXd;
 using Vector = Eigen::VectorXd;
 
 constexpr int IOMANIP_WIDTH = 38;
@@ -423,7 +424,8 @@ void printTestingResults(KNearestNeighbours const &kNearestNeighbours,
                          bool const additionalTestingDump)
 {
     KNearestNeighbours::TestingResults testingResults
-            = kNearestNeighbours.test(testingExamples);
+            = kNearestNeighbours.test(testingExamples,
+                                      ThreadPool::defaultNumberOfThreads());
 
     std::cout << "\r" << std::string(80, ' ') << "\r";
 
@@ -0,0 +1,68 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "neighbour-heap.hpp"
+
+#include <algorithm>
+#include <limits>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    /////////////////////////////////////////////////// | Class: NeighbourHeap <
+    //=========================================================== | Behaviour <<
+    //------------------------------------------------------- | Constructors <<<
+    NeighbourHeap::NeighbourHeap
+            (int const k)
+    {
+        clear(k);
+    }
+
+    //--------------------------------------------------------------- | Main <<<
+    void NeighbourHeap::clear
+            (int const k)
+    {
+        this->k = std::max(k, 1);
+        neighbours.clear();
+        neighbours.reserve(this->k);
+    }
+
+    void NeighbourHeap::push
+            (double const squaredDistance,
+             int const index)
+    {
+        if (!isFull())
+        {
+            neighbours.emplace_back(squaredDistance, index);
+            std::push_heap(neighbours.begin(), neighbours.end());
+        }
+        else if (squaredDistance < neighbours.front().first)
+        {
+            std::pop_heap(neighbours.begin(), neighbours.end());
+            neighbours.back() = { squaredDistance, index };
+            std::push_heap(neighbours.begin(), neighbours.end());
+        }
+    }
+
+    double NeighbourHeap::bound
+            () const
+    {
+        return isFull()
+               ? neighbours.front().first
+               : std::numeric_limits<double>::infinity();
+    }
+
+    std::vector<NeighbourHeap::Neighbour> const &NeighbourHeap::sort
+            ()
+    {
+        std::sort_heap(neighbours.begin(), neighbours.end());
+        return neighbours;
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    bool NeighbourHeap::isFull
+            () const
+    {
+        return static_cast<int>(neighbours.size()) >= k;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
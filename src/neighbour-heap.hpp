@@ -0,0 +1,56 @@
+#ifndef IAD_2A_NEIGHBOUR_HEAP_HPP
+#define IAD_2A_NEIGHBOUR_HEAP_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include <utility>
+#include <vector>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    /////////////////////////////////////////////////// | Class: NeighbourHeap <
+    // The k nearest candidates seen so far, as a max-heap of squared
+    // distances and indices, so the farthest of them is replaced in O(log k)
+    class NeighbourHeap final
+    {
+    public:
+        //=========================================================== | Types <<
+        using Neighbour = std::pair<double, int>;
+
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        explicit NeighbourHeap
+                (int k = 1);
+
+        //----------------------------------------------------------- | Main <<<
+        // Empties the heap, keeping its storage
+        void clear
+                (int k);
+
+        // Keeps the candidate if it is nearer than the farthest one kept
+        void push
+                (double squaredDistance,
+                 int index);
+
+        // Distance a candidate has to beat to be kept, infinite until k
+        // candidates are known
+        double bound
+                () const;
+
+        // Sorts the candidates from the nearest, which ends the heap order
+        // until the next call to clear
+        std::vector<Neighbour> const &sort
+                ();
+
+        //--------------------------------------------------------- | Traits <<<
+        bool isFull
+                () const;
+
+    private:
+        //============================================================ | Data <<
+        int k;
+        std::vector<Neighbour> neighbours;
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_NEIGHBOUR_HEAP_HPP
@@ -9,6 +9,11 @@ namespace NeuralNetworks
     ////////////////////////////////////////// | Interface: ActivationFunction <
     //=========================================================== | Behaviour <<
     //--------------------------------------------------------- | Destructor <<<
-    NeuralNetworkLayer::~NeuralNetworkLayer
+    template <typename Scalar>
+    BasicNeuralNetworkLayer<Scalar>::~BasicNeuralNetworkLayer
             () noexcept = default;
+
+    //============================================== | Explicit instantiation <<
+    template class BasicNeuralNetworkLayer<float>;
+    template class BasicNeuralNetworkLayer<double>;
 }
\ No newline at end of file
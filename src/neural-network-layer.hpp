@@ -10,56 +10,57 @@
 
 namespace NeuralNetworks
 {
-    class NeuralNetworkLayer
-            : private Cloneable<NeuralNetworkLayer>
+    template <typename Scalar>
+    class BasicNeuralNetworkLayer
+            : private Cloneable<BasicNeuralNetworkLayer<Scalar>>
     {
     public:
-        virtual Eigen::MatrixXd getWeights() = 0;
-        virtual void setWeights(Eigen::MatrixXd const &w) = 0;
-        virtual Eigen::VectorXd getBiases() = 0;
+        virtual Eigen::MatrixX<Scalar> getWeights() const = 0;
+        virtual void setWeights(Eigen::MatrixX<Scalar> const &w) = 0;
+        virtual Eigen::VectorX<Scalar> getBiases() const = 0;
         //======================================================= | Behaviour <<
         //----------------------------------------------------- | Destructor <<<
-        ~NeuralNetworkLayer
+        ~BasicNeuralNetworkLayer
                 () noexcept override = 0;
 
         //-------------------------- | Interface: Cloneable | Implementation <<<
-        std::unique_ptr<NeuralNetworkLayer> clone
+        std::unique_ptr<BasicNeuralNetworkLayer> clone
                 () const override = 0;
 
-        operator std::unique_ptr<NeuralNetworkLayer>
+        operator std::unique_ptr<BasicNeuralNetworkLayer>
                 () const override
         {
             return std::move(clone());
         }
 
         //------------------------------------------------------ | Operators <<<
-        virtual Eigen::VectorXd operator()
-                (Eigen::VectorXd const &inputs) const = 0;
+        virtual Eigen::VectorX<Scalar> operator()
+                (Eigen::VectorX<Scalar> const &inputs) const = 0;
 
         //------------------------------------------------- | Main behaviour <<<
-        virtual Eigen::VectorXd calculateOutputs
-                (Eigen::VectorXd const &inputs) const = 0;
+        virtual Eigen::VectorX<Scalar> calculateOutputs
+                (Eigen::VectorX<Scalar> const &inputs) const = 0;
 
-        virtual Eigen::VectorXd activate
-                (Eigen::VectorXd const &outputs) const = 0;
+        virtual Eigen::VectorX<Scalar> activate
+                (Eigen::VectorX<Scalar> const &outputs) const = 0;
 
-        virtual Eigen::VectorXd calculateOutputsDerivative
-                (Eigen::VectorXd const &outputs) const = 0;
+        virtual Eigen::VectorX<Scalar> calculateOutputsDerivative
+                (Eigen::VectorX<Scalar> const &outputs) const = 0;
 
-        virtual Eigen::VectorXd feedForward
-                (Eigen::VectorXd const &inputs) const = 0;
+        virtual Eigen::VectorX<Scalar> feedForward
+                (Eigen::VectorX<Scalar> const &inputs) const = 0;
 
-        virtual Eigen::VectorXd backpropagate
-                (Eigen::VectorXd const &inputs,
-                 Eigen::VectorXd const &errors,
-                 Eigen::VectorXd const &outputs,
-                 Eigen::VectorXd const &outputsDerivative) const = 0;
+        virtual Eigen::VectorX<Scalar> backpropagate
+                (Eigen::VectorX<Scalar> const &inputs,
+                 Eigen::VectorX<Scalar> const &errors,
+                 Eigen::VectorX<Scalar> const &outputs,
+                 Eigen::VectorX<Scalar> const &outputsDerivative) const = 0;
 
         virtual void calculateNextStep
-                (Eigen::VectorXd const &inputs,
-                 Eigen::VectorXd const &errors,
-                 Eigen::VectorXd const &outputs,
-                 Eigen::VectorXd const &outputsDerivative) = 0;
+                (Eigen::VectorX<Scalar> const &inputs,
+                 Eigen::VectorX<Scalar> const &errors,
+                 Eigen::VectorX<Scalar> const &outputs,
+                 Eigen::VectorX<Scalar> const &outputsDerivative) = 0;
 
         virtual void update
                 (double learningCoefficient,
@@ -68,6 +69,67 @@ namespace NeuralNetworks
         virtual void saveToFile
                 (std::string const &filename) const = 0;
 
+        //---------------------------------------------------------- | Batch <<<
+        // Each column of the matrices below holds one training example.
+        // Results are written into caller-provided buffers, and weighted
+        // errors are the errors multiplied by the outputs' derivative.
+        virtual void calculateOutputsBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputs) const = 0;
+
+        virtual void activateBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> activatedOutputs) const = 0;
+
+        virtual void calculateOutputsDerivativeBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputsDerivative)
+                const = 0;
+
+        virtual void activateWithDerivativeBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> activatedOutputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputsDerivative)
+                const = 0;
+
+        virtual void backpropagateBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> backpropagatedErrors)
+                const = 0;
+
+        virtual void calculateNextStepBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs) = 0;
+
+        //---------------------------------------------- | Parallel training <<<
+        // Copies weights and biases of a layer of the same type and shape
+        virtual void synchroniseParameters
+                (BasicNeuralNetworkLayer const &layer) = 0;
+
+        // Moves steps accumulated by a layer of the same type and shape
+        // into this layer's accumulators, leaving the other one empty
+        virtual void accumulateSteps
+                (BasicNeuralNetworkLayer &layer) = 0;
+
+        // Applies this layer's accumulated steps directly to the parameters
+        // of a layer of the same type and shape, without any locking
+        virtual void applyStepsTo
+                (BasicNeuralNetworkLayer &layer,
+                 double learningCoefficient,
+                 double momentumCoefficient) = 0;
+
+        // Called on a layer before and after threads apply their steps to
+        // it with applyStepsTo. State derived from the parameters is set
+        // aside in between, and rebuilt once at the end.
+        virtual void beginAsynchronousSteps
+                () = 0;
+
+        virtual void endAsynchronousSteps
+                () = 0;
+
         //--------------------------------------------------------- | Traits <<<
         virtual int numberOfInputs
                 () const = 0;
@@ -78,22 +140,25 @@ namespace NeuralNetworks
     protected:
         //======================================================= | Behaviour <<
         //--------------------------------------------------- | Constructors <<<
-        NeuralNetworkLayer
+        BasicNeuralNetworkLayer
                 () = default;
 
-        NeuralNetworkLayer
-                (NeuralNetworkLayer const &) = default;
+        BasicNeuralNetworkLayer
+                (BasicNeuralNetworkLayer const &) = default;
 
-        NeuralNetworkLayer
-                (NeuralNetworkLayer &&) = default;
+        BasicNeuralNetworkLayer
+                (BasicNeuralNetworkLayer &&) = default;
 
         //------------------------------------------------------ | Operators <<<
-        NeuralNetworkLayer &operator=
-                (NeuralNetworkLayer const &) = default;
+        BasicNeuralNetworkLayer &operator=
+                (BasicNeuralNetworkLayer const &) = default;
 
-        NeuralNetworkLayer &operator=
-                (NeuralNetworkLayer &&) = default;
+        BasicNeuralNetworkLayer &operator=
+                (BasicNeuralNetworkLayer &&) = default;
     };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using NeuralNetworkLayer = BasicNeuralNetworkLayer<double>;
 }
 
 #endif //IAD_2A_NEURAL_NETWORK_LAYER_HPP
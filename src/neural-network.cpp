@@ -1,5 +1,8 @@
 ///////////////////////////////////////////////////////////////////// | Includes
 #include "neural-network.hpp"
+#include "cost-accumulator.hpp"
+#include "accuracy-accumulator.hpp"
+#include "identity.hpp"
 
 #include <algorithm>
 #include <ctime>
@@ -11,13 +14,16 @@
 #include <tuple>
 #include <iomanip>
 #include <cmath>
+#include <numeric>
+#include <memory>
+#include <chrono>
+#include <stdexcept>
 
 
 
 /////////////////////////////////////////////////////////// | Using declarations
-using Array = Eigen::ArrayXd;
-using Matrix = Eigen::MatrixXd;
-using Vector = Eigen::VectorXd;
+template <typename Scalar>
+using Vector = Eigen::VectorX<Scalar>;
 
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
@@ -39,19 +45,6 @@ namespace NeuralNetworks
 
             return container;
         }
-
-        template <typename T>
-        T reverse
-                (T const &container)
-        {
-            T reversedContainer { std::size(container) };
-
-            std::reverse_copy(std::begin(container),
-                              std::end(container),
-                              std::begin(reversedContainer));
-
-            return reversedContainer;
-        }
     }
 
 
@@ -81,34 +74,53 @@ namespace NeuralNetworks
              std::vector<TrainingExample> const
              &testingExamples)
     {
-        int globalNumberOfAccurateClassifications = 0;
+        AccuracyAccumulator accuracy;
 
-        NeuralNetwork::TestingResults testingResults =
-                multiLayerPerceptron.test(testingExamples);
+        multiLayerPerceptron.evaluate(testingExamples, { accuracy });
 
-        for (auto const &testingResultsPerExample
-                : testingResults.testingResultsPerExample)
-        {
-            Vector::Index predictedClass, actualClass;
-            testingResultsPerExample.neurons
-                    .back().array().maxCoeff(&predictedClass);
-            testingResultsPerExample.targets.array().maxCoeff(&actualClass);
+        return accuracy.accuracy();
+    }
+
+    ////////////////////////////////////////////// | Class: BasicNeuralNetwork <
+    //========================================================== | Structures <<
+    //----------------------------------------------- | Structure: Workspace <<<
+    template <typename Scalar>
+    BasicNeuralNetwork<Scalar>::Workspace::Workspace
+            (Layers const &layers,
+             int const numberOfColumns)
+            :
+            Workspace { numbersOfNeurons(layers), numberOfColumns }
+    {
+    }
 
-            globalNumberOfAccurateClassifications
-                    += (int) (predictedClass == actualClass);
+    template <typename Scalar>
+    BasicNeuralNetwork<Scalar>::Workspace::Workspace
+            (std::vector<int> const &numbersOfNeurons,
+             int const numberOfColumns)
+    {
+        neurons.emplace_back(numbersOfNeurons.front(), numberOfColumns);
+        errors.emplace_back(numbersOfNeurons.front(), numberOfColumns);
+
+        for (auto numberOfOutputs = numbersOfNeurons.cbegin() + 1;
+             numberOfOutputs != numbersOfNeurons.cend();
+             ++numberOfOutputs)
+        {
+            outputs.emplace_back(*numberOfOutputs, numberOfColumns);
+            outputsDerivatives.emplace_back(*numberOfOutputs,
+                                            numberOfColumns);
+            weightedErrors.emplace_back(*numberOfOutputs, numberOfColumns);
+            neurons.emplace_back(*numberOfOutputs, numberOfColumns);
+            errors.emplace_back(*numberOfOutputs, numberOfColumns);
         }
-        double globalAccuracy = (double) globalNumberOfAccurateClassifications
-                                / testingExamples.size();
-        return globalAccuracy;
     }
 
-    /////////////////////////////////////////////////// | Class: NeuralNetwork <
     //============================================================= | Methods <<
     //----------------------------------------------------- | Static methods <<<
-    void NeuralNetwork::initialiseRandomNumberGenerator
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::initialiseRandomNumberGenerator
             (int const &seed)
     {
-        AffineLayer::initialiseRandomNumberGenerator(seed);
+        BasicAffineLayer<Scalar>::initialiseRandomNumberGenerator(seed);
     }
 
     //------------------------------------------------------- | Constructors <<<
@@ -121,31 +133,46 @@ namespace NeuralNetworks
 //    {
 //    }
 
-    NeuralNetwork::NeuralNetwork
+    template <typename Scalar>
+    BasicNeuralNetwork<Scalar>::BasicNeuralNetwork
             (std::vector<std::unique_ptr<NeuralNetworkLayer>> layers)
             :
             layers { std::move(layers) }
     {
     }
 
-    NeuralNetwork::NeuralNetwork
+    template <typename Scalar>
+    BasicNeuralNetwork<Scalar>::BasicNeuralNetwork
             (std::string const &filename)
     {
         readFromFile(filename);
     }
 
+    template <typename Scalar>
+    BasicNeuralNetwork<Scalar>::BasicNeuralNetwork
+            (BasicNeuralNetwork const &neuralNetwork)
+            :
+            frozenLayers { neuralNetwork.frozenLayers }
+    {
+        for (auto const &layer
+                : neuralNetwork.layers)
+            layers.emplace_back(layer->clone());
+    }
+
     //---------------------------------------------------------- | Operators <<<
-    Vector NeuralNetwork::operator()
-            (Vector const &inputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicNeuralNetwork<Scalar>::operator()
+            (Vector<Scalar> const &inputs) const
     {
         return feedForward(inputs);
     }
 
     //----------------------------------------------------- | Main behaviour <<<
-    Vector NeuralNetwork::feedForward
-            (Vector const &inputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicNeuralNetwork<Scalar>::feedForward
+            (Vector<Scalar> const &inputs) const
     {
-        Vector neurons = inputs;
+        Vector<Scalar> neurons = inputs;
 
         for (auto const &layer : layers)
             neurons = layer->feedForward(neurons);
@@ -153,7 +180,9 @@ namespace NeuralNetworks
         return neurons;
     }
 
-    NeuralNetwork::TrainingResults NeuralNetwork::train
+    template <typename Scalar>
+    typename BasicNeuralNetwork<Scalar>::TrainingResults
+    BasicNeuralNetwork<Scalar>::train
             (std::vector<TrainingExample> const &trainingExamples,
              std::vector<TrainingExample> const &testingExamples,
              std::vector<TrainingExample> const &testingExtrapolationExamples,
@@ -163,37 +192,99 @@ namespace NeuralNetworks
              double const learningCoefficientChange,
              double const momentumCoefficient,
              bool const shuffleTrainingData,
-             int const epochInterval)
+             int const epochInterval,
+             int const batchSize,
+             int const numberOfThreads,
+             ParallelTraining const parallelTraining,
+             bool const evaluateInBackground)
     {
         // Prepare results
         TrainingResults trainingResults;
         trainingResults.epochInterval = epochInterval;
 
+        // Compute outputs of the frozen prefix once, so that every epoch
+        // starts from them instead of the network's inputs
+        frozenLayers.resize(layers.size(), false);
+
+        std::size_t const firstLayer
+                = numberOfFrozenLeadingLayers(frozenLayers);
+
+        std::vector<TrainingExample> cachedTrainingExamples,
+                cachedTestingExamples,
+                cachedTestingExtrapolationExamples;
+
+        if (firstLayer > 0)
+        {
+            int const cacheBatchSize = std::max(batchSize, 64);
+
+            cachedTrainingExamples
+                    = calculateActivations(trainingExamples,
+                                           firstLayer,
+                                           cacheBatchSize);
+            cachedTestingExamples
+                    = calculateActivations(testingExamples,
+                                           firstLayer,
+                                           cacheBatchSize);
+            cachedTestingExtrapolationExamples
+                    = calculateActivations(testingExtrapolationExamples,
+                                           firstLayer,
+                                           cacheBatchSize);
+        }
+
+        auto const &epochTrainingExamples
+                = firstLayer > 0 ? cachedTrainingExamples : trainingExamples;
+        auto const &epochTestingExamples
+                = firstLayer > 0 ? cachedTestingExamples : testingExamples;
+        auto const &epochTestingExtrapolationExamples
+                = firstLayer > 0
+                  ? cachedTestingExtrapolationExamples
+                  : testingExtrapolationExamples;
+
         // Create container of training examples' iterators
         std::vector<decltype(trainingExamples.cbegin())>
                 trainingExamplesIterators;
 
-        for (auto trainingExample = trainingExamples.cbegin();
-             trainingExample != trainingExamples.cend();
+        for (auto trainingExample = epochTrainingExamples.cbegin();
+             trainingExample != epochTrainingExamples.cend();
              ++trainingExample)
         {
             trainingExamplesIterators.emplace_back(trainingExample);
         }
 
-        // Create container of layers' iterators
-        std::vector<decltype(layers.begin())>
-                layersIterators;
+        // Prepare buffers for every layer, sized once for the whole batch
+        Workspace workspace
+                { layers, std::max(batchSize, 1) };
 
-        for (auto layer = layers.begin();
-             layer != layers.end();
-             ++layer)
+        // Prepare worker threads, each with its own replica of the layers
+        // holding private step accumulators and buffers
+        std::unique_ptr<ThreadPool> threadPool;
+        std::vector<Replica> replicas;
+
+        if (numberOfThreads > 1)
         {
-            layersIterators.emplace_back(layer);
+            threadPool = std::make_unique<ThreadPool>(numberOfThreads);
+
+            for (int i = 0; i < numberOfThreads; ++i)
+            {
+                Layers replicaLayers;
+                for (auto const &layer : layers)
+                    replicaLayers.emplace_back(layer->clone());
+
+                Workspace replicaWorkspace
+                        { replicaLayers, std::max(batchSize, 1) };
+
+                replicas.push_back({ std::move(replicaLayers),
+                                     std::move(replicaWorkspace) });
+            }
         }
 
-        auto layersIteratorsReversed
-                { HelperFunctions::reverse(layersIterators) };
+        // Prepare a thread evaluating snapshots of the network
+        // on testing examples while training goes on
+        std::unique_ptr<ThreadPool> evaluator;
+        PendingEvaluations pendingEvaluations;
 
+        if (evaluateInBackground)
+            evaluator = std::make_unique<ThreadPool>(1);
 
         // Train the network
         for (int epoch = 0;
@@ -202,92 +293,54 @@ namespace NeuralNetworks
         {
             double costPerEpoch = 0.0;
 
-            for (auto const &trainingExamplesIterator
-                    : (shuffleTrainingData
-                       ? HelperFunctions::shuffle(trainingExamplesIterators)
-                       : trainingExamplesIterators))
-            {
-                auto const &firstLayerInputs
-                        = trainingExamplesIterator->inputs;
-
-                std::vector<Vector> neurons
-                        { firstLayerInputs };
-
-                std::vector<Vector> outputsDerivatives;
-
-                for (auto const &layer
-                        : layersIterators)
-                {
-                    Vector outputsDry = (*layer)->calculateOutputs(neurons.back
-                            ());
-                    outputsDerivatives.emplace_back
-                            ((*layer)->calculateOutputsDerivative(outputsDry));
-                    neurons.emplace_back
-                            ((*layer)->activate(outputsDry));
-                }
-
-                auto const &lastLayerOutputs
-                        = neurons.back();
-
-                auto const &lastLayerTargets
-                        = trainingExamplesIterator->outputs;
-
-                auto const lastLayerErrors
-                        = lastLayerTargets - lastLayerOutputs;
-
-                std::vector<Vector> errors
-                        { lastLayerErrors };
-
-                {
-                    auto inputsIterator = neurons.crbegin() + 1;
-                    auto outputsIterator = neurons.crbegin();
-                    auto derivativesIterator = outputsDerivatives.crbegin();
-
-                    for (auto const &layer
-                            : layersIteratorsReversed)
-                    {
-                        errors.emplace_back
-                                ((*layer)->backpropagate
-                                        (*inputsIterator,
-                                         errors.back(),
-                                         *outputsIterator,
-                                         *derivativesIterator));
-                        ++inputsIterator;
-                        ++outputsIterator;
-                        ++derivativesIterator;
-                    }
-                    errors = HelperFunctions::reverse(errors);
-                }
-
-                // Increment epoch's total cost
-                costPerEpoch += errors.back().array().square().sum() /
-                        trainingExamples.size();
+            auto const &trainingExamplesOrder
+                    = shuffleTrainingData
+                      ? HelperFunctions::shuffle(trainingExamplesIterators)
+                      : trainingExamplesIterators;
 
-                // Calculate steps for weights and biases
+            if (numberOfThreads > 1
+                && parallelTraining == ParallelTraining::Asynchronous)
+            {
+                costPerEpoch += trainAsynchronously
+                                        (trainingExamplesOrder.cbegin(),
+                                         trainingExamplesOrder.cend(),
+                                         batchSize,
+                                         learningCoefficient,
+                                         momentumCoefficient,
+                                         *threadPool,
+                                         replicas)
+                                / trainingExamples.size();
+            }
+            else
+            {
+                for (auto firstExample = trainingExamplesOrder.cbegin();
+                     firstExample != trainingExamplesOrder.cend();)
                 {
-                    auto inputsIterator = neurons.cbegin();
-                    auto outputsIterator = neurons.cbegin() + 1;
-                    auto derivativesIterator = outputsDerivatives.cbegin();
-                    auto errorsIterator = errors.cbegin() + 1;
-
-                    for (auto &layer
-                            : layersIterators)
-                    {
-                        (*layer)->calculateNextStep(*inputsIterator,
-                                                 *errorsIterator,
-                                                 *outputsIterator,
-                                                 *derivativesIterator);
-                        ++inputsIterator;
-                        ++outputsIterator;
-                        ++derivativesIterator;
-                        ++errorsIterator;
-                    }
+                    auto const lastExample
+                            = firstExample
+                              + std::min<std::ptrdiff_t>
+                                      (std::max(batchSize, 1),
+                                       trainingExamplesOrder.cend()
+                                       - firstExample);
+
+                    costPerEpoch += (numberOfThreads > 1
+                                     ? trainOnBatchInParallel
+                                             (firstExample,
+                                              lastExample,
+                                              learningCoefficient,
+                                              momentumCoefficient,
+                                              *threadPool,
+                                              replicas)
+                                     : trainOnBatch
+                                             (firstExample,
+                                              lastExample,
+                                              learningCoefficient,
+                                              momentumCoefficient,
+                                              workspace))
+                                    / trainingExamples.size();
+
+                    firstExample = lastExample;
                 }
-
-                // Update layers
-                for (auto &layer
-                        : layersIterators)
-                    (*layer)->update(learningCoefficient, momentumCoefficient);
             }
 
             if (std::isnan(costPerEpoch))
@@ -304,20 +357,70 @@ namespace NeuralNetworks
                 trainingResults.costPerEpochIntervalTraining
                         .emplace_back(costPerEpoch);
 
-                trainingResults.costPerEpochIntervalTesting
-                        .emplace_back(test(testingExamples).globalCost);
-                trainingResults.costPerEpochIntervalTestingExtrapolation
-                        .emplace_back(test(testingExtrapolationExamples).globalCost);
+                if (evaluateInBackground)
+                {
+                    collectEvaluations(trainingResults,
+                                       pendingEvaluations,
+                                       maximumNumberOfPendingEvaluations - 1);
+
+                    pendingEvaluations.push_back(evaluator->submit
+                            ([snapshot = std::make_shared
+                                    <BasicNeuralNetwork const>(*this),
+                              firstLayer,
+                              &epochTestingExamples,
+                              &epochTestingExtrapolationExamples]()
+                             {
+                                 BasicCostAccumulator<Scalar> testingCost,
+                                         testingExtrapolationCost;
+
+                                 snapshot->evaluateFromLayer
+                                         (firstLayer,
+                                          epochTestingExamples,
+                                          { testingCost });
+                                 snapshot->evaluateFromLayer
+                                         (firstLayer,
+                                          epochTestingExtrapolationExamples,
+                                          { testingExtrapolationCost });
+
+                                 return std::make_pair
+                                         (testingCost.cost(),
+                                          testingExtrapolationCost.cost());
+                             }));
+
+                    collectEvaluations(trainingResults,
+                                       pendingEvaluations,
+                                       maximumNumberOfPendingEvaluations);
+                }
+                else
+                {
+                    BasicCostAccumulator<Scalar> testingCost,
+                            testingExtrapolationCost;
+
+                    evaluateFromLayer(firstLayer,
+                                      epochTestingExamples,
+                                      { testingCost });
+                    evaluateFromLayer(firstLayer,
+                                      epochTestingExtrapolationExamples,
+                                      { testingExtrapolationCost });
+
+                    trainingResults.costPerEpochIntervalTesting
+                            .emplace_back(testingCost.cost());
+                    trainingResults.costPerEpochIntervalTestingExtrapolation
+                            .emplace_back(testingExtrapolationCost.cost());
+                }
 
+                // Background evaluations report their latest finished costs
                 std::cout << "\r"
                           << "> Epoch: " << std::setw(10) << epoch
                           << " | Cost (training): " << std::setw(10) << trainingResults
-                          .costPerEpochIntervalTraining.back()
-                          << " | Cost (testing): " << std::setw(10) << trainingResults
-                          .costPerEpochIntervalTesting.back()
-                          << " | Cost (testing extrapolation): "<<  std::setw(10)
-                              << trainingResults
-                                         .costPerEpochIntervalTestingExtrapolation.back();
+                          .costPerEpochIntervalTraining.back();
+
+                if (!trainingResults.costPerEpochIntervalTesting.empty())
+                    std::cout << " | Cost (testing): " << std::setw(10) << trainingResults
+                              .costPerEpochIntervalTesting.back()
+                              << " | Cost (testing extrapolation): "<<  std::setw(10)
+                                  << trainingResults
+                                             .costPerEpochIntervalTestingExtrapolation.back();
                 std::cout.flush();
             }
 
@@ -328,94 +431,138 @@ namespace NeuralNetworks
             learningCoefficient -= (learningCoefficientChange / numberOfEpochs);
         }
 
+        collectEvaluations(trainingResults, pendingEvaluations, 0);
+
         return trainingResults;
     }
 
-    NeuralNetwork::TestingResults NeuralNetwork::test
-            (std::vector<TrainingExample> const &testingExamples) const
+    template <typename Scalar>
+    double BasicNeuralNetwork<Scalar>::fitOutputLayer
+            (std::vector<TrainingExample> const &trainingExamples,
+             double const ridgeCoefficient,
+             int const batchSize)
     {
-        // Prepare results
-        TestingResults testingResults;
-        testingResults.globalCost = 0.0;
+        auto *const outputLayer
+                = dynamic_cast<BasicAffineLayer<Scalar> *>(layers.back().get());
+
+        if (outputLayer == nullptr
+            || dynamic_cast<BasicIdentity<Scalar> const *>
+                       (&outputLayer->getActivationFunction()) == nullptr)
+            throw std::invalid_argument
+                    ("fitOutputLayer needs an affine output layer with the "
+                     "identity activation function");
+
+        if (trainingExamples.empty())
+            return 0.0;
+
+        // Design matrix: one row per example holding the inputs of the
+        // output layer, followed by a column of ones for the biases
+        auto const numberOfExamples
+                = static_cast<Eigen::Index>(trainingExamples.size());
+        auto const numberOfFeatures = outputLayer->numberOfInputs();
+        bool const hasBiases = outputLayer->hasBiases();
+
+        Eigen::MatrixX<Scalar> design
+                { numberOfExamples, numberOfFeatures + (hasBiases ? 1 : 0) };
+        Eigen::MatrixX<Scalar> targets
+                { numberOfExamples, outputLayer->numberOfOutputs() };
+
+        if (hasBiases)
+            design.col(numberOfFeatures).setOnes();
+
+        Workspace workspace
+                { layers, std::max(batchSize, 1) };
+
+        for (Eigen::Index first = 0; first < numberOfExamples;)
+        {
+            auto const numberOfColumns
+                    = std::min<Eigen::Index>(std::max(batchSize, 1),
+                                             numberOfExamples - first);
 
-        // Create container of layers' iterators
-        std::vector<decltype(layers.begin())>
-                layersIterators;
+            for (Eigen::Index column = 0; column < numberOfColumns; ++column)
+            {
+                workspace.neurons.front().col(column)
+                        = trainingExamples[first + column].inputs;
+                targets.row(first + column)
+                        = trainingExamples[first + column].outputs.transpose();
+            }
 
-        for (auto layer = layers.begin();
-             layer != layers.end();
-             ++layer)
-        {
-            layersIterators.emplace_back(layer);
+            propagateForward(layers, workspace, numberOfColumns, false);
+
+            design.block(first, 0, numberOfColumns, numberOfFeatures)
+                    = workspace.neurons[layers.size() - 1]
+                            .leftCols(numberOfColumns).transpose();
+
+            first += numberOfColumns;
         }
 
-        auto layersIteratorsReversed
-                { HelperFunctions::reverse(layersIterators) };
+        // Ridge regression goes through the regularised normal equations,
+        // leaving the biases unpenalised; plain least squares through a
+        // rank-revealing factorisation of the design matrix itself
+        Eigen::MatrixX<Scalar> solution;
 
-        // Test the network
-        for (auto const &testingExample
-                : testingExamples)
+        if (ridgeCoefficient > 0.0)
         {
-            auto const &firstLayerInputs
-                    = testingExample.inputs;
+            Eigen::MatrixX<Scalar> gram = design.transpose() * design;
+            gram.diagonal().head(numberOfFeatures).array()
+                    += static_cast<Scalar>(ridgeCoefficient);
 
-            std::vector<Vector> neurons
-                    { firstLayerInputs };
+            solution = gram.ldlt().solve(design.transpose() * targets);
+        }
+        else
+            solution = design.completeOrthogonalDecomposition()
+                    .solve(targets);
 
-            std::vector<Vector> outputsDerivatives;
+        outputLayer->setWeights
+                (solution.topRows(numberOfFeatures).transpose());
 
-            for (auto const &layer
-                    : layersIterators)
-            {
-                Vector outputsDry = (*layer)->calculateOutputs(neurons.back());
-                outputsDerivatives.emplace_back
-                        ((*layer)->calculateOutputsDerivative(outputsDry));
-                neurons.emplace_back
-                        ((*layer)->activate(outputsDry));
-            }
+        if (hasBiases)
+            outputLayer->setBiases
+                    (solution.row(numberOfFeatures).transpose());
 
-            auto const &lastLayerOutputs
-                    = neurons.back();
+        BasicCostAccumulator<Scalar> trainingCost;
+        evaluate(trainingExamples, { trainingCost }, batchSize);
 
-            auto const &lastLayerTargets
-                    = testingExample.outputs;
+        return trainingCost.cost();
+    }
 
-            auto const lastLayerErrors
-                    = lastLayerTargets - lastLayerOutputs;
+    template <typename Scalar>
+    typename BasicNeuralNetwork<Scalar>::TestingResults
+    BasicNeuralNetwork<Scalar>::test
+            (std::vector<TrainingExample> const &testingExamples) const
+    {
+        // Prepare results
+        TestingResults testingResults;
+        testingResults.globalCost = 0.0;
 
-            std::vector<Vector> errors
-                    { lastLayerErrors };
+        // Prepare buffers for every layer
+        Workspace workspace
+                { layers };
 
-            {
-                auto inputsIterator = neurons.crbegin() + 1;
-                auto outputsIterator = neurons.crbegin();
-                auto derivativesIterator = outputsDerivatives.crbegin();
+        // Test the network
+        for (auto const &testingExample
+                : testingExamples)
+        {
+            workspace.neurons.front().col(0) = testingExample.inputs;
+            workspace.errors.back().col(0) = testingExample.outputs;
 
-                for (auto const &layer
-                        : layersIteratorsReversed)
-                {
-                    errors.emplace_back
-                            ((*layer)->backpropagate
-                                    (*inputsIterator,
-                                     errors.back(),
-                                     *outputsIterator,
-                                     *derivativesIterator));
-                    ++inputsIterator;
-                    ++outputsIterator;
-                    ++derivativesIterator;
-                }
-                errors = HelperFunctions::reverse(errors);
-            }
+            propagateForward(layers, workspace, 1);
+
+            workspace.errors.back() -= workspace.neurons.back();
+
+            propagateBackward(layers, workspace, 1, true);
 
             // Calculate cost
-            double cost = errors.back().array().square().sum();
+            double cost = workspace.errors.back().array().square().sum();
             testingResults.globalCost += cost / testingExamples.size();
 
             // Save testing results per example
             testingResults.testingResultsPerExample.push_back
-                    ({ neurons,
-                       lastLayerTargets,
-                       errors,
+                    ({ { workspace.neurons.cbegin(),
+                         workspace.neurons.cend() },
+                       testingExample.outputs,
+                       { workspace.errors.cbegin(),
+                         workspace.errors.cend() },
                        cost });
         }
 
@@ -426,7 +573,18 @@ namespace NeuralNetworks
         return testingResults;
     }
 
-    void NeuralNetwork::saveToFile
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::evaluate
+            (std::vector<TrainingExample> const &testingExamples,
+             std::vector<std::reference_wrapper<EvaluationAccumulator>>
+             const &accumulators,
+             int const batchSize) const
+    {
+        evaluateFromLayer(0, testingExamples, accumulators, batchSize);
+    }
+
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::saveToFile
             (std::string const &filename) const
     {
         std::ofstream file;
@@ -438,7 +596,8 @@ namespace NeuralNetworks
         file.close();
     }
 
-    void NeuralNetwork::readFromFile
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::readFromFile
             (std::string const &filename)
     {
         std::ifstream file(filename, std::ios::in | std::ios::binary);
@@ -449,7 +608,457 @@ namespace NeuralNetworks
         file.close();
     }
 
+    //----------------------------------------------------------- | Freezing <<<
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::freezeLayer
+            (std::size_t const index,
+             bool const isFrozen)
+    {
+        frozenLayers.resize(layers.size(), false);
+
+        if (index < frozenLayers.size())
+            frozenLayers[index] = isFrozen;
+    }
+
+    template <typename Scalar>
+    bool BasicNeuralNetwork<Scalar>::isLayerFrozen
+            (std::size_t const index) const
+    {
+        return index < frozenLayers.size() && frozenLayers[index];
+    }
+
     //----------------------------------------------------- | Helper methods <<<
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::propagateForward
+            (Layers const &layers,
+             Workspace &workspace,
+             Eigen::Index const numberOfColumns,
+             bool const calculateDerivatives,
+             std::size_t const firstLayer)
+    {
+        for (std::size_t i = firstLayer; i < layers.size(); ++i)
+        {
+            auto const inputs
+                    = workspace.neurons[i].leftCols(numberOfColumns);
+            auto outputs
+                    = workspace.outputs[i].leftCols(numberOfColumns);
+
+            layers[i]->calculateOutputsBatch(inputs, outputs);
+
+            if (calculateDerivatives)
+                layers[i]->activateWithDerivativeBatch
+                        (outputs,
+                         workspace.neurons[i + 1].leftCols(numberOfColumns),
+                         workspace.outputsDerivatives[i]
+                                 .leftCols(numberOfColumns));
+            else
+                layers[i]->activateBatch
+                        (outputs,
+                         workspace.neurons[i + 1].leftCols(numberOfColumns));
+        }
+    }
+
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::propagateBackward
+            (Layers const &layers,
+             Workspace &workspace,
+             Eigen::Index const numberOfColumns,
+             bool const backpropagateToInputs,
+             std::size_t const firstLayer)
+    {
+        for (std::size_t i = layers.size(); i-- > firstLayer;)
+        {
+            auto weightedErrors
+                    = workspace.weightedErrors[i].leftCols(numberOfColumns);
+
+            weightedErrors.array()
+                    = workspace.errors[i + 1].leftCols(numberOfColumns)
+                              .array()
+                      * workspace.outputsDerivatives[i]
+                              .leftCols(numberOfColumns).array();
+
+            // Errors of the network's inputs are only needed for reports
+            if (i > firstLayer || backpropagateToInputs)
+                layers[i]->backpropagateBatch
+                        (workspace.neurons[i].leftCols(numberOfColumns),
+                         weightedErrors,
+                         workspace.neurons[i + 1].leftCols(numberOfColumns),
+                         workspace.errors[i].leftCols(numberOfColumns));
+        }
+    }
+
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::calculateNextSteps
+            (Layers &layers,
+             std::vector<bool> const &frozenLayers,
+             Workspace &workspace,
+             Eigen::Index const numberOfColumns)
+    {
+        for (std::size_t i = 0; i < layers.size(); ++i)
+            if (!frozenLayers[i])
+                layers[i]->calculateNextStepBatch
+                        (workspace.neurons[i].leftCols(numberOfColumns),
+                         workspace.weightedErrors[i].leftCols(numberOfColumns),
+                         workspace.neurons[i + 1].leftCols(numberOfColumns));
+    }
+
+    template <typename Scalar>
+    double BasicNeuralNetwork<Scalar>::accumulateStepsOnBatch
+            (Layers &layers,
+             std::vector<bool> const &frozenLayers,
+             Workspace &workspace,
+             TrainingExamplesIterator const firstExample,
+             TrainingExamplesIterator const lastExample)
+    {
+        auto const numberOfColumns = lastExample - firstExample;
+        auto const firstLayer = numberOfFrozenLeadingLayers(frozenLayers);
+
+        // Pack the batch into the workspace, one training example per column
+        for (auto[example, column]
+             = std::make_tuple(firstExample, 0);
+             example != lastExample;
+             ++example, ++column)
+        {
+            workspace.neurons[firstLayer].col(column) = (*example)->inputs;
+            workspace.errors.back().col(column) = (*example)->outputs;
+        }
+
+        auto lastLayerErrors
+                = workspace.errors.back().leftCols(numberOfColumns);
+
+        propagateForward(layers, workspace, numberOfColumns, true, firstLayer);
+
+        lastLayerErrors
+                -= workspace.neurons.back().leftCols(numberOfColumns);
+
+        propagateBackward(layers,
+                          workspace,
+                          numberOfColumns,
+                          false,
+                          firstLayer);
+
+        calculateNextSteps(layers, frozenLayers, workspace, numberOfColumns);
+
+        // Return the batch's total cost
+        return lastLayerErrors.array().square().sum();
+    }
+
+    template <typename Scalar>
+    std::size_t BasicNeuralNetwork<Scalar>::numberOfFrozenLeadingLayers
+            (std::vector<bool> const &frozenLayers)
+    {
+        return static_cast<std::size_t>
+                (std::find(frozenLayers.cbegin(), frozenLayers.cend(), false)
+                 - frozenLayers.cbegin());
+    }
+
+    template <typename Scalar>
+    std::vector<int> BasicNeuralNetwork<Scalar>::numbersOfNeurons
+            (Layers const &layers)
+    {
+        std::vector<int> numbersOfNeurons
+                { layers.front()->numberOfInputs() };
+
+        for (auto const &layer
+                : layers)
+            numbersOfNeurons.push_back(layer->numberOfOutputs());
+
+        return numbersOfNeurons;
+    }
+
+    template <typename Scalar>
+    std::vector<typename BasicNeuralNetwork<Scalar>::TrainingExample>
+    BasicNeuralNetwork<Scalar>::calculateActivations
+            (std::vector<TrainingExample> const &examples,
+             std::size_t const numberOfLayers,
+             int const batchSize) const
+    {
+        Workspace workspace
+                { layers, std::max(batchSize, 1) };
+
+        std::vector<TrainingExample> activations;
+        activations.reserve(examples.size());
+
+        for (auto firstExample = examples.cbegin();
+             firstExample != examples.cend();)
+        {
+            auto const numberOfColumns
+                    = std::min<std::ptrdiff_t>(std::max(batchSize, 1),
+                                               examples.cend()
+                                               - firstExample);
+
+            for (int column = 0; column < numberOfColumns; ++column)
+                workspace.neurons.front().col(column)
+                        = firstExample[column].inputs;
+
+            for (std::size_t i = 0; i < numberOfLayers; ++i)
+            {
+                auto outputs
+                        = workspace.outputs[i].leftCols(numberOfColumns);
+
+                layers[i]->calculateOutputsBatch
+                        (workspace.neurons[i].leftCols(numberOfColumns),
+                         outputs);
+                layers[i]->activateBatch
+                        (outputs,
+                         workspace.neurons[i + 1].leftCols(numberOfColumns));
+            }
+
+            for (int column = 0; column < numberOfColumns; ++column)
+                activations.push_back
+                        ({ workspace.neurons[numberOfLayers].col(column),
+                           firstExample[column].outputs });
+
+            firstExample += numberOfColumns;
+        }
+
+        return activations;
+    }
+
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::evaluateFromLayer
+            (std::size_t const firstLayer,
+             std::vector<TrainingExample> const &testingExamples,
+             std::vector<std::reference_wrapper<EvaluationAccumulator>>
+             const &accumulators,
+             int const batchSize) const
+    {
+        // Prepare buffers for every layer
+        Workspace workspace
+                { layers, std::max(batchSize, 1) };
+
+        // Evaluate the network batch by batch
+        for (auto firstExample = testingExamples.cbegin();
+             firstExample != testingExamples.cend();)
+        {
+            auto const numberOfColumns
+                    = std::min<std::ptrdiff_t>(std::max(batchSize, 1),
+                                               testingExamples.cend()
+                                               - firstExample);
+
+            for (int column = 0; column < numberOfColumns; ++column)
+            {
+                workspace.neurons[firstLayer].col(column)
+                        = firstExample[column].inputs;
+                workspace.errors.back().col(column)
+                        = firstExample[column].outputs;
+            }
+
+            propagateForward(layers,
+                             workspace,
+                             numberOfColumns,
+                             false,
+                             firstLayer);
+
+            for (EvaluationAccumulator &accumulator
+                    : accumulators)
+                accumulator.accumulate
+                        (workspace.neurons.back().leftCols(numberOfColumns),
+                         workspace.errors.back().leftCols(numberOfColumns));
+
+            firstExample += numberOfColumns;
+        }
+    }
+
+    template <typename Scalar>
+    double BasicNeuralNetwork<Scalar>::trainOnBatch
+            (TrainingExamplesIterator const firstExample,
+             TrainingExamplesIterator const lastExample,
+             double const learningCoefficient,
+             double const momentumCoefficient,
+             Workspace &workspace)
+    {
+        double const cost
+                = accumulateStepsOnBatch(layers,
+                                         frozenLayers,
+                                         workspace,
+                                         firstExample,
+                                         lastExample);
+
+        // Update layers once per batch
+        for (std::size_t i = 0; i < layers.size(); ++i)
+            if (!frozenLayers[i])
+                layers[i]->update(learningCoefficient, momentumCoefficient);
+
+        return cost;
+    }
+
+    template <typename Scalar>
+    double BasicNeuralNetwork<Scalar>::trainOnBatchInParallel
+            (TrainingExamplesIterator const firstExample,
+             TrainingExamplesIterator const lastExample,
+             double const learningCoefficient,
+             double const momentumCoefficient,
+             ThreadPool &threadPool,
+             std::vector<Replica> &replicas)
+    {
+        // Split the batch into contiguous slices, one per replica
+        auto const numberOfReplicas
+                = static_cast<std::ptrdiff_t>(replicas.size());
+        auto const batchSize = lastExample - firstExample;
+
+        std::vector<double> costPerReplica(replicas.size(), 0.0);
+
+        threadPool.parallelFor
+                (static_cast<int>(replicas.size()),
+                 [&](int const replica)
+                 {
+                     auto const firstSliceExample
+                             = firstExample
+                               + batchSize * replica / numberOfReplicas;
+                     auto const lastSliceExample
+                             = firstExample
+                               + batchSize * (replica + 1) / numberOfReplicas;
+
+                     if (firstSliceExample == lastSliceExample)
+                         return;
+
+                     auto &[replicaLayers, replicaWorkspace]
+                             = replicas[replica];
+
+                     // Frozen layers were cloned with their final parameters
+                     for (std::size_t i = 0; i < layers.size(); ++i)
+                         if (!frozenLayers[i])
+                             replicaLayers[i]->synchroniseParameters
+                                     (*layers[i]);
+
+                     costPerReplica[replica]
+                             = accumulateStepsOnBatch(replicaLayers,
+                                                      frozenLayers,
+                                                      replicaWorkspace,
+                                                      firstSliceExample,
+                                                      lastSliceExample);
+                 });
+
+        // Reduce per-replica steps in a fixed order and update layers
+        for (std::size_t i = 0; i < layers.size(); ++i)
+        {
+            if (frozenLayers[i])
+                continue;
+
+            for (auto &replica
+                    : replicas)
+                layers[i]->accumulateSteps(*replica.layers[i]);
+
+            layers[i]->update(learningCoefficient, momentumCoefficient);
+        }
+
+        return std::accumulate(costPerReplica.cbegin(),
+                               costPerReplica.cend(),
+                               0.0);
+    }
+
+    template <typename Scalar>
+    double BasicNeuralNetwork<Scalar>::trainAsynchronously
+            (TrainingExamplesIterator const firstExample,
+             TrainingExamplesIterator const lastExample,
+             int const batchSize,
+             double const learningCoefficient,
+             double const momentumCoefficient,
+             ThreadPool &threadPool,
+             std::vector<Replica> &replicas)
+    {
+        // Split the epoch into contiguous shards, one per replica
+        auto const numberOfReplicas
+                = static_cast<std::ptrdiff_t>(replicas.size());
+        auto const numberOfExamples = lastExample - firstExample;
+
+        std::vector<double> costPerReplica(replicas.size(), 0.0);
+
+        for (std::size_t i = 0; i < layers.size(); ++i)
+            if (!frozenLayers[i])
+                layers[i]->beginAsynchronousSteps();
+
+        threadPool.parallelFor
+                (static_cast<int>(replicas.size()),
+                 [&](int const replica)
+                 {
+                     auto &[replicaLayers, replicaWorkspace]
+                             = replicas[replica];
+
+                     auto const lastShardExample
+                             = firstExample
+                               + numberOfExamples * (replica + 1)
+                                 / numberOfReplicas;
+
+                     for (auto firstBatchExample
+                             = firstExample
+                               + numberOfExamples * replica
+                                 / numberOfReplicas;
+                          firstBatchExample != lastShardExample;)
+                     {
+                         auto const lastBatchExample
+                                 = firstBatchExample
+                                   + std::min<std::ptrdiff_t>
+                                           (std::max(batchSize, 1),
+                                            lastShardExample
+                                            - firstBatchExample);
+
+                         // Unsynchronised reads of the shared weights
+                         // and unsynchronised writes of the steps
+                         for (std::size_t i = 0; i < layers.size(); ++i)
+                             if (!frozenLayers[i])
+                                 replicaLayers[i]->synchroniseParameters
+                                         (*layers[i]);
+
+                         costPerReplica[replica]
+                                 += accumulateStepsOnBatch
+                                         (replicaLayers,
+                                          frozenLayers,
+                                          replicaWorkspace,
+                                          firstBatchExample,
+                                          lastBatchExample);
+
+                         for (std::size_t i = 0; i < layers.size(); ++i)
+                             if (!frozenLayers[i])
+                                 replicaLayers[i]->applyStepsTo
+                                         (*layers[i],
+                                          learningCoefficient,
+                                          momentumCoefficient);
+
+                         firstBatchExample = lastBatchExample;
+                     }
+                 });
+
+        // Only now that no thread reads the layers can they rebuild
+        for (std::size_t i = 0; i < layers.size(); ++i)
+            if (!frozenLayers[i])
+                layers[i]->endAsynchronousSteps();
+
+        return std::accumulate(costPerReplica.cbegin(),
+                               costPerReplica.cend(),
+                               0.0);
+    }
+
+    template <typename Scalar>
+    void BasicNeuralNetwork<Scalar>::collectEvaluations
+            (TrainingResults &trainingResults,
+             PendingEvaluations &pendingEvaluations,
+             std::size_t const maximumNumberPending)
+    {
+        // Evaluations finish in submission order, so costs stay aligned
+        // with their epoch intervals
+        while (!pendingEvaluations.empty()
+               && (pendingEvaluations.size() > maximumNumberPending
+                   || pendingEvaluations.front().wait_for
+                                   (std::chrono::seconds::zero())
+                      == std::future_status::ready))
+        {
+            auto const [testingCost, testingExtrapolationCost]
+                    = pendingEvaluations.front().get();
+            pendingEvaluations.pop_front();
+
+            trainingResults.costPerEpochIntervalTesting
+                    .emplace_back(testingCost);
+            trainingResults.costPerEpochIntervalTestingExtrapolation
+                    .emplace_back(testingExtrapolationCost);
+        }
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicNeuralNetwork<float>;
+    template class BasicNeuralNetwork<double>;
+
 //    std::vector<Vector> NeuralNetwork::feedForwardPerLayer
 //            (Vector const &inputs) const
 //    {
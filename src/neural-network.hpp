@@ -5,10 +5,17 @@
 #include "parametric-rectified-linear-unit.hpp"
 
 #include <Eigen/Eigen>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "neural-network-layer.hpp"
+#include "thread-pool.hpp"
+#include "evaluation-accumulator.hpp"
 
 #include <cereal/types/vector.hpp>
 #include <cereal/types/polymorphic.hpp>
@@ -17,39 +24,66 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    /////////////////////////////////////////////////// | Class: NeuralNetwork <
-    class NeuralNetwork final
+    ////////////////////////////////////////////// | Class: BasicNeuralNetwork <
+    template <typename Scalar>
+    class BasicNeuralNetwork final
     {
     public:
+        //=========================================================== | Types <<
+        using TrainingExample = BasicTrainingExample<Scalar>;
+        using NeuralNetworkLayer = BasicNeuralNetworkLayer<Scalar>;
+        using EvaluationAccumulator = BasicEvaluationAccumulator<Scalar>;
+
         //====================================================== | Structures <<
         struct TrainingResults;
 
         struct TestingResults;
         struct TestingResultsPerExample;
 
+        struct Workspace;
+
+        //=========================================================== | Enums <<
+        enum class ParallelTraining
+        {
+            // Threads share every mini-batch and their steps are reduced
+            // before a single update, as in single-threaded training
+            Synchronous,
+
+            // Threads train on their own share of the examples and update
+            // the shared weights without locks (Hogwild)
+            Asynchronous
+        };
+
         //======================================================= | Behaviour <<
         //--------------------------------------------------------- | Static <<<
         static void initialiseRandomNumberGenerator
                 (int const &seed);
 
         //--------------------------------------------------- | Constructors <<<
-//        explicit NeuralNetwork
+//        explicit BasicNeuralNetwork
 //                (std::vector<int> const &numberOfNeurons,
 //                 std::vector<bool> const &enableBiasPerLayer);
 
-        explicit NeuralNetwork
+        explicit BasicNeuralNetwork
                 (std::vector<std::unique_ptr<NeuralNetworkLayer>> layers);
 
-        explicit NeuralNetwork
+        explicit BasicNeuralNetwork
                 (std::string const &filename);
 
+        // Deep copy, cloning every layer
+        BasicNeuralNetwork
+                (BasicNeuralNetwork const &neuralNetwork);
+
+        BasicNeuralNetwork
+                (BasicNeuralNetwork &&) = default;
+
         //------------------------------------------------------ | Operators <<<
-        Eigen::VectorXd operator()
-                (Eigen::VectorXd const &inputs) const;
+        Eigen::VectorX<Scalar> operator()
+                (Eigen::VectorX<Scalar> const &inputs) const;
 
         //----------------------------------------------------------- | Main <<<
-        Eigen::VectorXd feedForward
-                (Eigen::VectorXd const &inputs) const;
+        Eigen::VectorX<Scalar> feedForward
+                (Eigen::VectorX<Scalar> const &inputs) const;
 
         TrainingResults train
                 (std::vector<TrainingExample> const &trainingExamples,
@@ -61,21 +95,60 @@ namespace NeuralNetworks
                  double learningCoefficientChange = 0.0,
                  double momentumCoefficient = 0.0,
                  bool shuffleTrainingData = true,
-                 int epochInterval = 1);
+                 int epochInterval = 1,
+                 int batchSize = 1,
+                 int numberOfThreads = 1,
+                 ParallelTraining parallelTraining
+                 = ParallelTraining::Synchronous,
+                 bool evaluateInBackground = false);
+
+        // Solves for the output layer in closed form, keeping the layers
+        // before it fixed: their outputs over all examples form a design
+        // matrix and the least-squares weights and biases are written back.
+        // The output layer has to be affine with the identity activation.
+        // A positive ridge coefficient adds ridgeCoefficient * ||W||^2 to the
+        // cost. Returns the cost on the training examples after the solve.
+        double fitOutputLayer
+                (std::vector<TrainingExample> const &trainingExamples,
+                 double ridgeCoefficient = 0.0,
+                 int batchSize = 64);
 
         TestingResults test // TODO: Rename Training to Testing
                 (std::vector<TrainingExample> const &testingExamples) const;
 
+        // Runs the forward pass only, in batches, and feeds the outputs
+        // to the accumulators instead of storing results per example
+        void evaluate
+                (std::vector<TrainingExample> const &testingExamples,
+                 std::vector<std::reference_wrapper<EvaluationAccumulator>>
+                 const &accumulators,
+                 int batchSize = 64) const;
+
         void saveToFile
                 (std::string const &filename) const;
 
         void readFromFile
                 (std::string const &filename);
 
+        //------------------------------------------------------- | Freezing <<<
+        // Frozen layers keep their parameters during training. Outputs of
+        // the leading frozen layers are computed once per call to train for
+        // every training and testing example, and epochs start from them.
+        void freezeLayer
+                (std::size_t index,
+                 bool isFrozen = true);
+
+        bool isLayerFrozen
+                (std::size_t index) const;
+
     public:
         //============================================================ | Data <<
         std::vector<std::unique_ptr<NeuralNetworkLayer>> layers;
 
+    private:
+        //============================================================ | Data <<
+        std::vector<bool> frozenLayers;
+
         //======================================================= | Behaviour <<
         //-------------------------------------------------- | Serialization <<<
         friend class cereal::access;
@@ -94,7 +167,112 @@ namespace NeuralNetworks
             archive(layers);
         }
 
+    private:
+        //=========================================================== | Types <<
+        using TrainingExamplesIterator
+                = typename std::vector
+                        <typename std::vector<TrainingExample>::const_iterator>
+                  ::const_iterator;
+
+        using Layers
+                = std::vector<std::unique_ptr<NeuralNetworkLayer>>;
+
+        // Costs on the testing and testing extrapolation examples
+        using PendingEvaluations
+                = std::deque<std::future<std::pair<double, double>>>;
+
+        // Every pending evaluation holds a copy of the network, so training
+        // waits rather than queue more of them
+        static constexpr std::size_t maximumNumberOfPendingEvaluations = 2;
+
+        //====================================================== | Structures <<
+        struct Replica;
+
+        //======================================================= | Behaviour <<
         //----------------------------------------------- | Helper functions <<<
+        // Passes start at firstLayer, whose inputs are already in the
+        // workspace's neurons; layers before it are not touched
+        static void propagateForward
+                (Layers const &layers,
+                 Workspace &workspace,
+                 Eigen::Index numberOfColumns,
+                 bool calculateDerivatives = true,
+                 std::size_t firstLayer = 0);
+
+        static void propagateBackward
+                (Layers const &layers,
+                 Workspace &workspace,
+                 Eigen::Index numberOfColumns,
+                 bool backpropagateToInputs,
+                 std::size_t firstLayer = 0);
+
+        static void calculateNextSteps
+                (Layers &layers,
+                 std::vector<bool> const &frozenLayers,
+                 Workspace &workspace,
+                 Eigen::Index numberOfColumns);
+
+        // Examples' inputs are taken as inputs of the first layer that is
+        // not part of the frozen prefix
+        static double accumulateStepsOnBatch
+                (Layers &layers,
+                 std::vector<bool> const &frozenLayers,
+                 Workspace &workspace,
+                 TrainingExamplesIterator firstExample,
+                 TrainingExamplesIterator lastExample);
+
+        static std::size_t numberOfFrozenLeadingLayers
+                (std::vector<bool> const &frozenLayers);
+
+        // Inputs of the first layer followed by outputs of every layer
+        static std::vector<int> numbersOfNeurons
+                (Layers const &layers);
+
+        // Same examples with the inputs replaced by the outputs of the
+        // first numberOfLayers layers
+        std::vector<TrainingExample> calculateActivations
+                (std::vector<TrainingExample> const &examples,
+                 std::size_t numberOfLayers,
+                 int batchSize) const;
+
+        void evaluateFromLayer
+                (std::size_t firstLayer,
+                 std::vector<TrainingExample> const &testingExamples,
+                 std::vector<std::reference_wrapper<EvaluationAccumulator>>
+                 const &accumulators,
+                 int batchSize = 64) const;
+
+        double trainOnBatch
+                (TrainingExamplesIterator firstExample,
+                 TrainingExamplesIterator lastExample,
+                 double learningCoefficient,
+                 double momentumCoefficient,
+                 Workspace &workspace);
+
+        double trainOnBatchInParallel
+                (TrainingExamplesIterator firstExample,
+                 TrainingExamplesIterator lastExample,
+                 double learningCoefficient,
+                 double momentumCoefficient,
+                 ThreadPool &threadPool,
+                 std::vector<Replica> &replicas);
+
+        double trainAsynchronously
+                (TrainingExamplesIterator firstExample,
+                 TrainingExamplesIterator lastExample,
+                 int batchSize,
+                 double learningCoefficient,
+                 double momentumCoefficient,
+                 ThreadPool &threadPool,
+                 std::vector<Replica> &replicas);
+
+        // Collects finished evaluations, waiting for the oldest ones while
+        // more than maximumNumberPending are left
+        static void collectEvaluations
+                (TrainingResults &trainingResults,
+                 PendingEvaluations &pendingEvaluations,
+                 std::size_t maximumNumberPending);
+
 //        std::vector<Eigen::VectorXd> feedForwardPerLayer
 //                (Eigen::VectorXd const &inputs) const;
 //
@@ -104,9 +282,10 @@ namespace NeuralNetworks
 
     };
 
-    //============================ | Class: NeuralNetwork | Structures <<
+    //============================== | Class: BasicNeuralNetwork | Structures <<
     //----------------------------------------- | Structure: TrainingResults <<<
-    struct NeuralNetwork::TrainingResults
+    template <typename Scalar>
+    struct BasicNeuralNetwork<Scalar>::TrainingResults
     {
         int epochInterval;
         std::vector<double> costPerEpochIntervalTraining;
@@ -115,21 +294,55 @@ namespace NeuralNetworks
     };
 
     //------------------------------------------ | Structure: TestingResults <<<
-    struct NeuralNetwork::TestingResults
+    template <typename Scalar>
+    struct BasicNeuralNetwork<Scalar>::TestingResults
     {
         double globalCost;
         std::vector<TestingResultsPerExample> testingResultsPerExample;
     };
 
     //-------------------------------- | Structure: TestingResultsPerExample <<<
-    struct NeuralNetwork::TestingResultsPerExample
+    template <typename Scalar>
+    struct BasicNeuralNetwork<Scalar>::TestingResultsPerExample
     {
-        std::vector<Eigen::VectorXd> neurons;
-        Eigen::VectorXd targets;
-        std::vector<Eigen::VectorXd> errors;
+        std::vector<Eigen::VectorX<Scalar>> neurons;
+        Eigen::VectorX<Scalar> targets;
+        std::vector<Eigen::VectorX<Scalar>> errors;
         double cost;
     };
 
+    //----------------------------------------------- | Structure: Workspace <<<
+    // Buffers reused by every forward and backward pass, one column per
+    // example, so that training and testing do not allocate per example
+    template <typename Scalar>
+    struct BasicNeuralNetwork<Scalar>::Workspace
+    {
+        explicit Workspace
+                (Layers const &layers,
+                 int numberOfColumns = 1);
+
+        // Numbers of neurons are given per level, starting with the inputs
+        explicit Workspace
+                (std::vector<int> const &numbersOfNeurons,
+                 int numberOfColumns = 1);
+
+        std::vector<Eigen::MatrixX<Scalar>> neurons;
+        std::vector<Eigen::MatrixX<Scalar>> outputs;
+        std::vector<Eigen::MatrixX<Scalar>> outputsDerivatives;
+        std::vector<Eigen::MatrixX<Scalar>> weightedErrors;
+        std::vector<Eigen::MatrixX<Scalar>> errors;
+    };
+
+    //------------------------------------------------- | Structure: Replica <<<
+    template <typename Scalar>
+    struct BasicNeuralNetwork<Scalar>::Replica
+    {
+        Layers layers;
+        Workspace workspace;
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using NeuralNetwork = BasicNeuralNetwork<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1,49 +1,117 @@
 ///////////////////////////////////////////////////////////////////// | Includes
 #include "parametric-rectified-linear-unit.hpp"
+#include "activation-kernels.hpp"
 
 /////////////////////////////////////////////////////////// | Using declarations
-using Array = Eigen::ArrayXd;
+template <typename Scalar>
+using Array = Eigen::ArrayX<Scalar>;
+
+template <typename Scalar>
+using Array2DReference = Eigen::Ref<Eigen::ArrayXX<Scalar> const>;
+
+template <typename Scalar>
+using Array2DMutableReference = Eigen::Ref<Eigen::ArrayXX<Scalar>>;
 
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    /////////////////////////////////// | Class: ParametricRectifiedLinearUnit <
+    ////////////////////////////// | Class: BasicParametricRectifiedLinearUnit <
     //============================================================= | Methods <<
     //------------------------------------------------------- | Constructors <<<
-    ParametricRectifiedLinearUnit::ParametricRectifiedLinearUnit
+    template <typename Scalar>
+    BasicParametricRectifiedLinearUnit<Scalar>::BasicParametricRectifiedLinearUnit
             ()
             :
-            ParametricRectifiedLinearUnit(0.0)
+            BasicParametricRectifiedLinearUnit(Scalar(0))
     {
     }
 
-    ParametricRectifiedLinearUnit::ParametricRectifiedLinearUnit
-            (double const &parameter)
+    template <typename Scalar>
+    BasicParametricRectifiedLinearUnit<Scalar>::BasicParametricRectifiedLinearUnit
+            (Scalar const &parameter)
             :
             parameter { parameter }
     {
     }
 
     //-------------------------------- | Interface implementation: Cloneable <<<
-    std::unique_ptr<ActivationFunction> ParametricRectifiedLinearUnit::clone
+    template <typename Scalar>
+    std::unique_ptr<BasicActivationFunction<Scalar>>
+    BasicParametricRectifiedLinearUnit<Scalar>::clone
             () const
     {
-        return std::make_unique<ParametricRectifiedLinearUnit>(*this);
+        return std::make_unique<BasicParametricRectifiedLinearUnit>(*this);
     }
 
     //----------------------- | Interface implementation: ActivationFunction <<<
-    Array ParametricRectifiedLinearUnit::operator()
-            (Array const &inputs) const
+    template <typename Scalar>
+    Array<Scalar> BasicParametricRectifiedLinearUnit<Scalar>::operator()
+            (Array<Scalar> const &inputs) const
+    {
+        Array<Scalar> outputs(inputs.size());
+        ActivationKernels::parametricRectifiedLinearUnit<Scalar>
+                (inputs.data(), outputs.data(), nullptr, inputs.size(),
+                 parameter);
+        return outputs;
+    }
+
+    template <typename Scalar>
+    Array<Scalar> BasicParametricRectifiedLinearUnit<Scalar>::derivative
+            (Array<Scalar> const &inputs) const
+    {
+        Array<Scalar> derivatives(inputs.size());
+        ActivationKernels::parametricRectifiedLinearUnit<Scalar>
+                (inputs.data(), nullptr, derivatives.data(), inputs.size(),
+                 parameter);
+        return derivatives;
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    template <typename Scalar>
+    auto BasicParametricRectifiedLinearUnit<Scalar>::kernel
+            () const
+    {
+        return [this](Scalar const *inputs,
+                      Scalar *outputs,
+                      Scalar *derivatives,
+                      std::ptrdiff_t const size)
+               {
+                   ActivationKernels::parametricRectifiedLinearUnit<Scalar>
+                           (inputs, outputs, derivatives, size, parameter);
+               };
+    }
+
+    //-------------------------------------------------------------- | Batch <<<
+    template <typename Scalar>
+    void BasicParametricRectifiedLinearUnit<Scalar>::activateBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> outputs) const
     {
-        return inputs.max(0.0) + parameter * inputs.min(0.0);
+        ActivationKernels::apply<Scalar>(kernel(), inputs, &outputs, nullptr);
     }
 
-    Array ParametricRectifiedLinearUnit::derivative
-            (Array const &inputs) const
+    template <typename Scalar>
+    void BasicParametricRectifiedLinearUnit<Scalar>::derivativeBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> derivatives) const
     {
-        return inputs.max(0.0).sign().abs()
-               + parameter * inputs.min(0.0).sign().abs();
+        ActivationKernels::apply<Scalar>
+                (kernel(), inputs, nullptr, &derivatives);
     }
+
+    template <typename Scalar>
+    void BasicParametricRectifiedLinearUnit<Scalar>::activateWithDerivativeBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> outputs,
+             Array2DMutableReference<Scalar> derivatives) const
+    {
+        ActivationKernels::apply<Scalar>
+                (kernel(), inputs, &outputs, &derivatives);
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicParametricRectifiedLinearUnit<float>;
+    template class BasicParametricRectifiedLinearUnit<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -10,50 +10,64 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    ///////////////////////////////////////////// | Class: RectifiedLinearUnit <
-    class ParametricRectifiedLinearUnit final
-            : public ActivationFunction
+    ////////////////////////////// | Class: BasicParametricRectifiedLinearUnit <
+    template <typename Scalar>
+    class BasicParametricRectifiedLinearUnit final
+            : public BasicActivationFunction<Scalar>
     {
     public:
         //======================================================= | Behaviour <<
         //--------------------------------------------------- | Constructors <<<
-        ParametricRectifiedLinearUnit
+        BasicParametricRectifiedLinearUnit
                 ();
 
-        explicit ParametricRectifiedLinearUnit
-                (double const &parameter);
+        explicit BasicParametricRectifiedLinearUnit
+                (Scalar const &parameter);
 
-        ParametricRectifiedLinearUnit
-                (ParametricRectifiedLinearUnit const &) = default;
+        BasicParametricRectifiedLinearUnit
+                (BasicParametricRectifiedLinearUnit const &) = default;
 
-        ParametricRectifiedLinearUnit
-                (ParametricRectifiedLinearUnit &&) = default;
+        BasicParametricRectifiedLinearUnit
+                (BasicParametricRectifiedLinearUnit &&) = default;
 
         //------------------------------------------------------ | Operators <<<
-        ParametricRectifiedLinearUnit &operator=
-                (ParametricRectifiedLinearUnit const &) = default;
+        BasicParametricRectifiedLinearUnit &operator=
+                (BasicParametricRectifiedLinearUnit const &) = default;
 
-        ParametricRectifiedLinearUnit &operator=
-                (ParametricRectifiedLinearUnit &&) = default;
+        BasicParametricRectifiedLinearUnit &operator=
+                (BasicParametricRectifiedLinearUnit &&) = default;
 
         //----------------------------------------------------- | Destructor <<<
-        ~ParametricRectifiedLinearUnit
+        ~BasicParametricRectifiedLinearUnit
                 () noexcept final = default;
 
         //---------------------------- | Interface implementation: Cloneable <<<
-        std::unique_ptr<ActivationFunction> clone
+        std::unique_ptr<BasicActivationFunction<Scalar>> clone
                 () const final;
 
         //------------------- | Interface implementation: ActivationFunction <<<
-        Eigen::ArrayXd operator()
-                (Eigen::ArrayXd const &input) const final;
+        Eigen::ArrayX<Scalar> operator()
+                (Eigen::ArrayX<Scalar> const &input) const final;
 
-        Eigen::ArrayXd derivative
-                (Eigen::ArrayXd const &input) const final;
+        Eigen::ArrayX<Scalar> derivative
+                (Eigen::ArrayX<Scalar> const &input) const final;
+
+        void activateBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs) const final;
+
+        void derivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const final;
+
+        void activateWithDerivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const final;
 
     private:
         //========================================================== | Fields <<
-        double parameter;
+        Scalar parameter;
 
         //======================================================= | Behaviour <<
         //------------------------------------------ | cereal: Serialization <<<
@@ -72,13 +86,27 @@ namespace NeuralNetworks
         {
             archive(parameter);
         }
+
+        //----------------------------------------------- | Helper functions <<<
+        // Kernel with the parameter bound, taken by ActivationKernels::apply
+        auto kernel
+                () const;
     };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using ParametricRectifiedLinearUnit
+            = BasicParametricRectifiedLinearUnit<double>;
 }
 
 //////////////////////////////////////// | cereal: Polymorphic type registration
 CEREAL_REGISTER_TYPE(NeuralNetworks::ParametricRectifiedLinearUnit)
+CEREAL_REGISTER_TYPE(NeuralNetworks::BasicParametricRectifiedLinearUnit<float>)
+
 CEREAL_REGISTER_POLYMORPHIC_RELATION(NeuralNetworks::ActivationFunction,
         NeuralNetworks::ParametricRectifiedLinearUnit)
+CEREAL_REGISTER_POLYMORPHIC_RELATION
+        (NeuralNetworks::BasicActivationFunction<float>,
+         NeuralNetworks::BasicParametricRectifiedLinearUnit<float>)
 
 ////////////////////////////////////////////////////////////////////////////////
 #endif // IAD_2A_PARAMETRIC_RECTIFIED_LINEAR_UNIT_HPP
@@ -0,0 +1,289 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "radial-basis-function-layer.hpp"
+
+#include <Eigen/Eigen>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Compares the batch gradients of RadialBasisFunctionLayer with central
+// finite differences of the cost and with per-element loops over the
+// formulas o_ik = exp(-b_i^2 ||x_k - w_i||^2), for every centre visited and
+// with the centre tree. Run by ctest; exits with failure on any mismatch.
+
+using namespace NeuralNetworks;
+using Matrix = Eigen::MatrixXd;
+using Vector = Eigen::VectorXd;
+
+constexpr int NUMBER_OF_INPUTS = 3;
+constexpr int NUMBER_OF_OUTPUTS = 5;
+constexpr int NUMBER_OF_EXAMPLES = 7;
+
+constexpr double FINITE_DIFFERENCE_STEP = 1e-6;
+constexpr double TOLERANCE = 1e-6;
+
+// Steps and errors the layer calculates for a batch
+struct Gradients
+{
+    Matrix weightsStep;
+    Vector biasesStep;
+    Matrix backpropagatedErrors;
+};
+
+// Half of the squared error over the batch, the cost whose negative
+// gradient training steps along
+double calculateCost
+        (RadialBasisFunctionLayer const &layer,
+         Matrix const &inputs,
+         Matrix const &targets)
+{
+    Matrix outputs { NUMBER_OF_OUTPUTS, inputs.cols() };
+    Matrix activatedOutputs { NUMBER_OF_OUTPUTS, inputs.cols() };
+
+    layer.calculateOutputsBatch(inputs, outputs);
+    layer.activateBatch(outputs, activatedOutputs);
+
+    return 0.5 * (targets - activatedOutputs).squaredNorm();
+}
+
+Gradients calculateBatchGradients
+        (RadialBasisFunctionLayer const &layer,
+         Matrix const &inputs,
+         Matrix const &targets)
+{
+    Matrix outputs { NUMBER_OF_OUTPUTS, inputs.cols() };
+    Matrix activatedOutputs { NUMBER_OF_OUTPUTS, inputs.cols() };
+    Matrix outputsDerivative { NUMBER_OF_OUTPUTS, inputs.cols() };
+
+    layer.calculateOutputsBatch(inputs, outputs);
+    layer.activateWithDerivativeBatch(outputs,
+                                      activatedOutputs,
+                                      outputsDerivative);
+
+    Matrix const weightedErrors
+            = (targets - activatedOutputs).cwiseProduct(outputsDerivative);
+
+    Gradients gradients;
+    gradients.backpropagatedErrors.resize(NUMBER_OF_INPUTS, inputs.cols());
+
+    layer.backpropagateBatch(inputs,
+                             weightedErrors,
+                             activatedOutputs,
+                             gradients.backpropagatedErrors);
+
+    // Steps are private, so they are read back from a plain update, which
+    // adds their average to the parameters
+    RadialBasisFunctionLayer steppedLayer { layer };
+
+    steppedLayer.calculateNextStepBatch(inputs,
+                                        weightedErrors,
+                                        activatedOutputs);
+    steppedLayer.update(1.0, 0.0);
+
+    gradients.weightsStep = inputs.cols() * (steppedLayer.getWeights()
+                                             - layer.getWeights());
+    gradients.biasesStep = inputs.cols() * (steppedLayer.getBiases()
+                                            - layer.getBiases());
+
+    return gradients;
+}
+
+// Steps are the cost's negative gradient, and so are the backpropagated
+// errors with respect to the inputs
+Gradients calculateFiniteDifferenceGradients
+        (RadialBasisFunctionLayer const &layer,
+         Matrix const &inputs,
+         Matrix const &targets)
+{
+    Gradients gradients
+            { Matrix { NUMBER_OF_OUTPUTS, NUMBER_OF_INPUTS },
+              Vector { NUMBER_OF_OUTPUTS },
+              Matrix { NUMBER_OF_INPUTS, inputs.cols() } };
+
+    RadialBasisFunctionLayer perturbedLayer { layer };
+
+    for (int i = 0; i < NUMBER_OF_OUTPUTS; ++i)
+        for (int j = 0; j < NUMBER_OF_INPUTS; ++j)
+        {
+            Matrix weights = layer.getWeights();
+
+            weights(i, j) += FINITE_DIFFERENCE_STEP;
+            perturbedLayer.setWeights(weights);
+            double const forwardCost
+                    = calculateCost(perturbedLayer, inputs, targets);
+
+            weights(i, j) -= 2.0 * FINITE_DIFFERENCE_STEP;
+            perturbedLayer.setWeights(weights);
+            double const backwardCost
+                    = calculateCost(perturbedLayer, inputs, targets);
+
+            gradients.weightsStep(i, j)
+                    = -(forwardCost - backwardCost)
+                      / (2.0 * FINITE_DIFFERENCE_STEP);
+        }
+
+    perturbedLayer.setWeights(layer.getWeights());
+
+    for (int i = 0; i < NUMBER_OF_OUTPUTS; ++i)
+    {
+        Vector biases = layer.getBiases();
+
+        biases(i) += FINITE_DIFFERENCE_STEP;
+        perturbedLayer.setBiases(biases);
+        double const forwardCost
+                = calculateCost(perturbedLayer, inputs, targets);
+
+        biases(i) -= 2.0 * FINITE_DIFFERENCE_STEP;
+        perturbedLayer.setBiases(biases);
+        double const backwardCost
+                = calculateCost(perturbedLayer, inputs, targets);
+
+        gradients.biasesStep(i)
+                = -(forwardCost - backwardCost)
+                  / (2.0 * FINITE_DIFFERENCE_STEP);
+    }
+
+    for (int j = 0; j < NUMBER_OF_INPUTS; ++j)
+        for (int k = 0; k < inputs.cols(); ++k)
+        {
+            Matrix perturbedInputs = inputs;
+
+            perturbedInputs(j, k) += FINITE_DIFFERENCE_STEP;
+            double const forwardCost
+                    = calculateCost(layer, perturbedInputs, targets);
+
+            perturbedInputs(j, k) -= 2.0 * FINITE_DIFFERENCE_STEP;
+            double const backwardCost
+                    = calculateCost(layer, perturbedInputs, targets);
+
+            gradients.backpropagatedErrors(j, k)
+                    = -(forwardCost - backwardCost)
+                      / (2.0 * FINITE_DIFFERENCE_STEP);
+        }
+
+    return gradients;
+}
+
+// Identity activation, so that the weighted errors are the errors
+Gradients calculatePerElementGradients
+        (RadialBasisFunctionLayer const &layer,
+         Matrix const &inputs,
+         Matrix const &targets)
+{
+    Matrix const weights = layer.getWeights();
+    Vector const biases = layer.getBiases();
+
+    Gradients gradients
+            { Matrix::Zero(NUMBER_OF_OUTPUTS, NUMBER_OF_INPUTS),
+              Vector::Zero(NUMBER_OF_OUTPUTS),
+              Matrix::Zero(NUMBER_OF_INPUTS, inputs.cols()) };
+
+    for (int k = 0; k < inputs.cols(); ++k)
+        for (int i = 0; i < NUMBER_OF_OUTPUTS; ++i)
+        {
+            double squaredDistance = 0.0;
+
+            for (int j = 0; j < NUMBER_OF_INPUTS; ++j)
+                squaredDistance += std::pow(inputs(j, k) - weights(i, j), 2);
+
+            double const output
+                    = std::exp(-biases(i) * biases(i) * squaredDistance);
+            double const error = targets(i, k) - output;
+
+            for (int j = 0; j < NUMBER_OF_INPUTS; ++j)
+            {
+                double const term
+                        = 2.0 * error * output * biases(i) * biases(i)
+                          * (inputs(j, k) - weights(i, j));
+
+                gradients.weightsStep(i, j) += term;
+                gradients.backpropagatedErrors(j, k) -= term;
+            }
+
+            gradients.biasesStep(i)
+                    -= 2.0 * biases(i) * error * output * squaredDistance;
+        }
+
+    return gradients;
+}
+
+bool compare
+        (std::string const &name,
+         Matrix const &calculated,
+         Matrix const &expected)
+{
+    double const error
+            = ((calculated - expected).array().abs()
+               / (1.0 + expected.array().abs())).maxCoeff();
+
+    bool const isMatching = error <= TOLERANCE;
+
+    std::cout << (isMatching ? "OK   " : "FAIL ") << name
+              << " | Largest relative error: " << error << '\n';
+
+    return isMatching;
+}
+
+bool compare
+        (std::string const &name,
+         Gradients const &calculated,
+         Gradients const &expected)
+{
+    bool isMatching = compare(name + " | Weights",
+                              calculated.weightsStep,
+                              expected.weightsStep);
+    isMatching &= compare(name + " | Biases",
+                          calculated.biasesStep,
+                          expected.biasesStep);
+    isMatching &= compare(name + " | Inputs",
+                          calculated.backpropagatedErrors,
+                          expected.backpropagatedErrors);
+
+    return isMatching;
+}
+
+int main
+        ()
+{
+    RadialBasisFunctionLayer::initialiseRandomNumberGenerator(1);
+
+    RadialBasisFunctionLayer layer
+            { NUMBER_OF_INPUTS, NUMBER_OF_OUTPUTS };
+
+    // Widths large enough for some centres to fall below the tolerance
+    layer.setBiases(Vector::Constant(NUMBER_OF_OUTPUTS, 1.5)
+                    + 0.5 * Vector::Random(NUMBER_OF_OUTPUTS));
+
+    Matrix const inputs
+            = Matrix::Random(NUMBER_OF_INPUTS, NUMBER_OF_EXAMPLES);
+    Matrix const targets
+            = Matrix::Random(NUMBER_OF_OUTPUTS, NUMBER_OF_EXAMPLES);
+
+    bool isMatching = true;
+
+    for (double const outputTolerance : { 0.0, 1e-12 })
+    {
+        layer.setOutputTolerance(outputTolerance);
+
+        std::string const name
+                = outputTolerance > 0.0 ? "Centre tree" : "Every centre";
+
+        Gradients const batchGradients
+                = calculateBatchGradients(layer, inputs, targets);
+
+        isMatching &= compare(name + " | Finite differences",
+                              batchGradients,
+                              calculateFiniteDifferenceGradients(layer,
+                                                                 inputs,
+                                                                 targets));
+        isMatching &= compare(name + " | Per element",
+                              batchGradients,
+                              calculatePerElementGradients(layer,
+                                                           inputs,
+                                                           targets));
+    }
+
+    return isMatching ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,64 +1,86 @@
 ///////////////////////////////////////////////////////////////////// | Includes
 #include "radial-basis-function-layer.hpp"
 #include "identity.hpp"
+#include "k-means.hpp"
 
 #include <cereal/archives/binary.hpp>
 #include <cereal/cereal.hpp>
 #include <cereal/types/base_class.hpp>
 #include <cereal/types/memory.hpp>
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <utility>
 
 /////////////////////////////////////////////////////////// | Using declarations
-using Array = Eigen::ArrayXd;
-using Matrix = Eigen::MatrixXd;
-using Vector = Eigen::VectorXd;
+template <typename Scalar>
+using Array = Eigen::ArrayX<Scalar>;
+
+template <typename Scalar>
+using Matrix = Eigen::MatrixX<Scalar>;
+
+template <typename Scalar>
+using Vector = Eigen::VectorX<Scalar>;
+
+template <typename Scalar>
+using MatrixReference = Eigen::Ref<Eigen::MatrixX<Scalar> const>;
+
+template <typename Scalar>
+using MatrixMutableReference = Eigen::Ref<Eigen::MatrixX<Scalar>>;
 
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    //////////////////////////////////////// | Class: RadialBasisFunctionLayer <
+    /////////////////////////////////// | Class: BasicRadialBasisFunctionLayer <
     //============================================================= | Methods <<
     //----------------------------------------------------- | Static methods <<<
-    void RadialBasisFunctionLayer::initialiseRandomNumberGenerator
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::initialiseRandomNumberGenerator
             (int const seed)
     {
         srand(static_cast<unsigned int>(seed));
     }
 
     //------------------------------------------------------- | Constructors <<<
-    RadialBasisFunctionLayer::RadialBasisFunctionLayer
+    template <typename Scalar>
+    BasicRadialBasisFunctionLayer<Scalar>::BasicRadialBasisFunctionLayer
             ()
             :
-            RadialBasisFunctionLayer(1, 1, Identity {})
+            BasicRadialBasisFunctionLayer(1, 1, BasicIdentity<Scalar> {})
     {
     }
 
-    RadialBasisFunctionLayer::RadialBasisFunctionLayer
+    template <typename Scalar>
+    BasicRadialBasisFunctionLayer<Scalar>::BasicRadialBasisFunctionLayer
             (int const numberOfInputs,
              int const numberOfOutputs,
-             ActivationFunction const &activationFunction)
+             BasicActivationFunction<Scalar> const &activationFunction)
             :
             weights { std::sqrt(2.0 / (numberOfInputs + numberOfOutputs))
-                      * Matrix::Random(numberOfOutputs, numberOfInputs) },
-            deltaWeights { Matrix::Zero(numberOfOutputs, numberOfInputs) },
-            momentumWeights { Matrix::Zero(numberOfOutputs, numberOfInputs) },
+                      * Matrix<Scalar>::Random(numberOfOutputs,
+                                               numberOfInputs) },
+            deltaWeights { Matrix<Scalar>::Zero(numberOfOutputs,
+                                                numberOfInputs) },
+            momentumWeights { Matrix<Scalar>::Zero(numberOfOutputs,
+                                                   numberOfInputs) },
 
             biases { std::sqrt(2.0 / (numberOfInputs + numberOfOutputs))
-                     * ((Vector::Random(numberOfOutputs).array() + 1.0)
+                     * ((Vector<Scalar>::Random(numberOfOutputs).array() + 1.0)
                         / 2.0).matrix() },
-            deltaBiases { Vector::Zero(numberOfOutputs) },
-            momentumBiases { Vector::Zero(numberOfOutputs) },
+            deltaBiases { Vector<Scalar>::Zero(numberOfOutputs) },
+            momentumBiases { Vector<Scalar>::Zero(numberOfOutputs) },
 
             activationFunction { activationFunction.clone() },
             currentNumberOfSteps { 0 }
     {
+        updateCentresSquaredNorms();
     }
 
-    RadialBasisFunctionLayer::RadialBasisFunctionLayer
+    template <typename Scalar>
+    BasicRadialBasisFunctionLayer<Scalar>::BasicRadialBasisFunctionLayer
             (std::string const &filename)
     {
         std::ifstream file;
@@ -70,8 +92,9 @@ namespace NeuralNetworks
         file.close();
     }
 
-    RadialBasisFunctionLayer::RadialBasisFunctionLayer
-            (RadialBasisFunctionLayer const &layer)
+    template <typename Scalar>
+    BasicRadialBasisFunctionLayer<Scalar>::BasicRadialBasisFunctionLayer
+            (BasicRadialBasisFunctionLayer const &layer)
             :
             weights { layer.weights },
             deltaWeights { layer.deltaWeights },
@@ -80,242 +103,403 @@ namespace NeuralNetworks
             deltaBiases { layer.deltaBiases },
             momentumBiases { layer.momentumBiases },
             activationFunction { layer.activationFunction->clone() },
-            currentNumberOfSteps { layer.currentNumberOfSteps }
+            currentNumberOfSteps { layer.currentNumberOfSteps },
+            centresSquaredNorms { layer.centresSquaredNorms },
+            outputTolerance { layer.outputTolerance },
+            centreTree { layer.centreTree },
+            isCentreTreeStale { layer.isCentreTreeStale }
     {
     }
 
     //---------------------------------------------------------- | Operators <<<
-    Vector RadialBasisFunctionLayer::operator()
-            (Vector const &inputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicRadialBasisFunctionLayer<Scalar>::operator()
+            (Vector<Scalar> const &inputs) const
     {
         return feedForward(inputs);
     }
 
     //------------------------------ | Interface: Cloneable | Implementation <<<
-    std::unique_ptr<NeuralNetworkLayer> RadialBasisFunctionLayer::clone
+    template <typename Scalar>
+    std::unique_ptr<BasicNeuralNetworkLayer<Scalar>>
+    BasicRadialBasisFunctionLayer<Scalar>::clone
             () const
     {
-        return std::make_unique<RadialBasisFunctionLayer>(*this);
+        return std::make_unique<BasicRadialBasisFunctionLayer>(*this);
     }
 
     //----------------------------------------------------- | Main behaviour <<<
-    Vector RadialBasisFunctionLayer::calculateOutputs
-            (Vector const &inputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicRadialBasisFunctionLayer<Scalar>::calculateOutputs
+            (Vector<Scalar> const &inputs) const
     {
-        Vector outputs
+        Vector<Scalar> outputs
                 { numberOfOutputs() };
 
-        for (int i = 0;
-             i < numberOfOutputs();
-             ++i)
-        {
-            outputs(i)
-                    = std::exp(-std::pow(biases(i), 2)
-                               * (inputs - Vector(weights.row(i)))
-                                           .squaredNorm());
-        }
+        calculateOutputsBatch(inputs, outputs);
 
         return outputs;
     }
 
-    Vector RadialBasisFunctionLayer::activate
-            (Vector const &outputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicRadialBasisFunctionLayer<Scalar>::activate
+            (Vector<Scalar> const &outputs) const
     {
         return (*activationFunction)(outputs);
     }
 
-    Vector RadialBasisFunctionLayer::calculateOutputsDerivative
-            (Vector const &outputs) const
+    template <typename Scalar>
+    Vector<Scalar>
+    BasicRadialBasisFunctionLayer<Scalar>::calculateOutputsDerivative
+            (Vector<Scalar> const &outputs) const
     {
         return activationFunction->derivative(outputs);
     }
 
-    Vector RadialBasisFunctionLayer::feedForward
-            (Vector const &inputs) const
+    template <typename Scalar>
+    Vector<Scalar> BasicRadialBasisFunctionLayer<Scalar>::feedForward
+            (Vector<Scalar> const &inputs) const
     {
         return calculateOutputs(inputs);
     }
 
-    double RadialBasisFunctionLayer
-    ::calculateDerivativeOfOutputWithRespectToBias(
-            Vector const &inputs,
-            double const output,
-            Vector const &weights,
-            double const bias) const
-    {
-        double sum = 0.0;
-        for (int j = 0; j < numberOfInputs(); ++j)
-            sum += std::pow(inputs(j) - weights(j), 2);
-
-        return output
-               * (-sum)
-               * 2.0 * bias;
-    }
-    double RadialBasisFunctionLayer
-    ::calculateDerivativeOfOutputWithRespectToWeight(
-            double const input,
-            double const output,
-            double const weight,
-            double const bias) const
-    {
-        return output
-               * (-std::pow(bias, 2))
-               * 2.0 * (input - weight)
-               * (-1.0);
-    }
-    double RadialBasisFunctionLayer
-    ::calculateDerivativeOfOutputWithRespectToInput(
-            double const input,
-            double const output,
-            double const weight,
-            double const bias) const
-    {
-        return output
-               * (-std::pow(bias, 2))
-               * 2.0 * (input - weight)
-               * 1.0;
-    }
-    double RadialBasisFunctionLayer
-    ::calculateDerivativeOfCostWithRespectToOutput(double const error) const
-    {
-        return -error;
-    }
-    double RadialBasisFunctionLayer::calculateDerivativeOfCostWithRespectToInput
-            (double const input,
-             Vector const &weights,
-             Vector const &errors,
-             Vector const &outputs,
-             Vector const &outputsDerivative) const
-    {
-        double derivativeOfCostWithRespectToInput = 0.0;
-
-        for (int i = 0;
-             i < numberOfOutputs();
-             ++i)
+    template <typename Scalar>
+    Vector<Scalar> BasicRadialBasisFunctionLayer<Scalar>::backpropagate
+            (Vector<Scalar> const &inputs,
+             Vector<Scalar> const &errors,
+             Vector<Scalar> const &outputs,
+             Vector<Scalar> const &outputsDerivative) const
+    {
+        Vector<Scalar> const weightedErrors
+                = errors.array() * outputsDerivative.array();
+
+        Vector<Scalar> backpropagatedErrors
+                { numberOfInputs() };
+
+        backpropagateBatch(inputs,
+                           weightedErrors,
+                           outputs,
+                           backpropagatedErrors);
+
+        return backpropagatedErrors;
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::calculateNextStep
+            (Vector<Scalar> const &inputs,
+             Vector<Scalar> const &errors,
+             Vector<Scalar> const &outputs,
+             Vector<Scalar> const &outputsDerivative)
+    {
+        Vector<Scalar> const weightedErrors
+                = errors.array() * outputsDerivative.array();
+
+        calculateNextStepBatch(inputs,
+                               weightedErrors,
+                               outputs);
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::update
+            (double const learningCoefficient,
+             double const momentumCoefficient)
+    {
+        applyAverageOfDeltaStepsToMomentumStep(learningCoefficient,
+                                               momentumCoefficient);
+        applyMomentumStepToWeightsAndBiases();
+        resetStepData();
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::saveToFile
+            (std::string const &filename) const
+    {
+        std::ofstream file;
+        file.open(filename, std::ios::binary | std::ios::trunc);
         {
-            derivativeOfCostWithRespectToInput
-                    += calculateDerivativeOfCostWithRespectToOutput(errors(i))
-                       * outputsDerivative(i)
-                       * calculateDerivativeOfOutputWithRespectToInput(
-                               input, outputs(i), biases(i), weights(i)
-                               );
+            cereal::BinaryOutputArchive binaryOutputArchive(file);
+            binaryOutputArchive(*this);
+        }
+        file.close();
+    }
 
+    //-------------------------------------------------------------- | Batch <<<
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::calculateOutputsBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixMutableReference<Scalar> outputs) const
+    {
+        if (isCentreTreeUsable())
+        {
+            calculateOutputsLocalBatch(inputs, outputs);
+            return;
         }
 
-        return derivativeOfCostWithRespectToInput;
+        calculateSquaredDistancesBatch(inputs, outputs);
+
+        outputs.array()
+                = (outputs.array().colwise()
+                   * -biases.array().square()).exp();
     }
 
-    Vector RadialBasisFunctionLayer::backpropagate
-            (Vector const &inputs,
-             Vector const &errors,
-             Vector const &outputs,
-             Vector const &outputsDerivative) const
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::activateBatch
+            (MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> activatedOutputs) const
     {
-        Vector backpropagatedErrors { numberOfInputs() };
+        activationFunction->activateBatch(outputs.array(),
+                                          activatedOutputs.array());
+    }
 
-        for (int j = 0;
-             j < numberOfInputs();
-             ++j)
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::calculateOutputsDerivativeBatch
+            (MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> outputsDerivative) const
+    {
+        activationFunction->derivativeBatch(outputs.array(),
+                                            outputsDerivative.array());
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::activateWithDerivativeBatch
+            (MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> activatedOutputs,
+             MatrixMutableReference<Scalar> outputsDerivative) const
+    {
+        activationFunction->activateWithDerivativeBatch
+                (outputs.array(),
+                 activatedOutputs.array(),
+                 outputsDerivative.array());
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::backpropagateBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixReference<Scalar> const &weightedErrors,
+             MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> backpropagatedErrors) const
+    {
+        if (isCentreTreeUsable())
         {
-            backpropagatedErrors(j)
-                    = -calculateDerivativeOfCostWithRespectToInput
-                            (inputs(j), Vector{weights.col(j)},
-                             errors,
-                             outputs,
-                             outputsDerivative);
+            backpropagateLocalBatch(inputs,
+                                    weightedErrors,
+                                    outputs,
+                                    backpropagatedErrors);
+            return;
         }
 
-        return backpropagatedErrors;
+        // With g_ik = e_ik o_ik b_i^2, the error of input j is
+        // -2 sum_i g_ik (x_jk - w_ij)
+        calculateScaledErrorsBatch(weightedErrors, outputs);
+
+        backpropagatedErrors.noalias()
+                = Scalar(2) * weights.transpose() * scaledErrors;
+        backpropagatedErrors.array()
+                -= Scalar(2)
+                   * (inputs.array().rowwise()
+                      * scaledErrors.colwise().sum().array());
     }
 
-    void RadialBasisFunctionLayer::calculateNextStep
-            (Vector const &inputs,
-             Vector const &errors,
-             Vector const &outputs,
-             Vector const &outputsDerivative)
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::calculateNextStepBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixReference<Scalar> const &weightedErrors,
+             MatrixReference<Scalar> const &outputs)
     {
-        for (int i = 0; i < numberOfOutputs(); ++i)
-            for (int j = 0; j < numberOfInputs(); ++j)
-            {
-                deltaWeights(i, j)
-                        -= calculateDerivativeOfCostWithRespectToOutput(errors
-                                (i)) * outputsDerivative(i) *
-                                        calculateDerivativeOfOutputWithRespectToWeight(
-                                                inputs(j), outputs(j),
-                                                weights(i, j), biases(i)
-                                                );
-                // TODO: Include derivative of activation function
-                /*deltaWeights(i, j) -= -errors(i)
-                                      * outputsDerivative(i)
-                                      * outputs(i)
-                                      * (-biases(i))
-                                      * 2.0 * (inputs(j) - weights(i, j)) *
-                                      (-1.0);*/
-            }
-
-        for (int i = 0; i < numberOfOutputs(); ++i)
+        if (isCentreTreeUsable())
         {
-            deltaBiases(i)
-                -= calculateDerivativeOfCostWithRespectToOutput(errors(i))
-                        * outputsDerivative(i) *
-                        calculateDerivativeOfOutputWithRespectToBias(
-                                inputs, outputs(i), Vector {weights.row(i)},
-                                biases(i)
-                                );
-
-            /*double sumOfSomething = 0.0;
-            for (int j = 0; j < numberOfInputs(); ++j)
-            {
-                sumOfSomething += std::pow(inputs(j) - weights(i, j), 2);
-            }
-            // TODO: Include derivative of activation function
-            deltaBiases(i) -= -errors(i)
-                              * outputsDerivative(i)
-                              * outputs(i)
-                              * (-sumOfSomething);*/
+            calculateNextStepLocalBatch(inputs, weightedErrors, outputs);
+            return;
         }
 
-        ++currentNumberOfSteps;
+        // Steps for w_ij and b_i summed over the batch:
+        // 2 sum_k g_ik (x_jk - w_ij) and -2 b_i sum_k e_ik o_ik d_ik
+        calculateScaledErrorsBatch(weightedErrors, outputs);
+
+        deltaWeights.noalias() += Scalar(2) * scaledErrors * inputs.transpose();
+        deltaWeights.noalias()
+                -= (Scalar(2) * scaledErrors.rowwise().sum()).asDiagonal()
+                   * weights;
+
+        // The outputs already hold the distances, as b_i^2 d_ik = -ln o_ik,
+        // so the step is 2 / b_i sum_k e_ik o_ik ln o_ik. Outputs of 0 and
+        // widths of 0 add nothing.
+        scaledErrors.array()
+                = weightedErrors.array() * outputs.array()
+                  * (outputs.array() > Scalar(0))
+                            .select(outputs.array().log(), Scalar(0));
+
+        deltaBiases.array()
+                += (biases.array() != Scalar(0))
+                           .select(Scalar(2)
+                                   * scaledErrors.array().rowwise().sum()
+                                   / biases.array(),
+                                   Scalar(0));
+
+        currentNumberOfSteps += inputs.cols();
     }
 
-    void RadialBasisFunctionLayer::update
-            (double const learningCoefficient,
+    //-------------------------------------------------- | Parallel training <<<
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::synchroniseParameters
+            (BasicNeuralNetworkLayer<Scalar> const &layer)
+    {
+        auto const &other
+                = dynamic_cast<BasicRadialBasisFunctionLayer const &>(layer);
+
+        weights = other.weights;
+        biases = other.biases;
+        centresSquaredNorms = other.centresSquaredNorms;
+
+        // The tree follows the other layer's centres, so it is copied
+        // rather than rebuilt by every replica on every batch
+        outputTolerance = other.outputTolerance;
+        centreTree = other.centreTree;
+        isCentreTreeStale = other.isCentreTreeStale;
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::accumulateSteps
+            (BasicNeuralNetworkLayer<Scalar> &layer)
+    {
+        auto &other = dynamic_cast<BasicRadialBasisFunctionLayer &>(layer);
+
+        deltaWeights.noalias() += other.deltaWeights;
+        other.deltaWeights.setZero();
+
+        deltaBiases.noalias() += other.deltaBiases;
+        other.deltaBiases.setZero();
+
+        currentNumberOfSteps += other.currentNumberOfSteps;
+        other.currentNumberOfSteps = 0;
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::applyStepsTo
+            (BasicNeuralNetworkLayer<Scalar> &layer,
+             double const learningCoefficient,
              double const momentumCoefficient)
     {
+        auto &other = dynamic_cast<BasicRadialBasisFunctionLayer &>(layer);
+
         applyAverageOfDeltaStepsToMomentumStep(learningCoefficient,
                                                momentumCoefficient);
-        applyMomentumStepToWeightsAndBiases();
+
+        // Hogwild: other threads may read or write these concurrently
+        other.weights.noalias() += momentumWeights;
+        other.biases.noalias() += momentumBiases;
+        other.updateCentresSquaredNorms();
+
         resetStepData();
     }
 
-    void RadialBasisFunctionLayer::saveToFile
-            (std::string const &filename) const
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::beginAsynchronousSteps
+            ()
     {
-        std::ofstream file;
-        file.open(filename, std::ios::binary | std::ios::trunc);
+        // Replicas copy the flag and search every centre until the end
+        isCentreTreeStale = outputTolerance > 0.0;
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::endAsynchronousSteps
+            ()
+    {
+        updateCentreTree();
+    }
+
+    //----------------------------------------------------- | Initialisation <<<
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::initialiseCentres
+            (std::vector<BasicTrainingExample<Scalar>> const &examples,
+             int const maximumNumberOfIterations,
+             int const numberOfThreads)
+    {
+        if (examples.empty())
+            return;
+
+        Matrix<Scalar> inputs { numberOfInputs(),
+                                static_cast<Eigen::Index>(examples.size()) };
+
+        for (std::size_t k = 0; k < examples.size(); ++k)
+            inputs.col(k) = examples[k].inputs;
+
+        BasicKMeans<Scalar> const kMeans { numberOfOutputs(),
+                                           maximumNumberOfIterations,
+                                           numberOfThreads };
+
+        Matrix<Scalar> const centroids = kMeans.cluster(inputs);
+
+        // Fewer distinct examples than centres leave the rest where they are
+        weights.topRows(centroids.cols()) = centroids.transpose();
+
+        // Fallback width for a lone centroid or coinciding ones: the root
+        // mean squared distance of the examples to their centroids
+        Scalar const meanDistance
+                = std::sqrt(kMeans.getSquaredDistances().mean());
+
+        for (Eigen::Index i = 0; i < centroids.cols(); ++i)
         {
-            cereal::BinaryOutputArchive binaryOutputArchive(file);
-            binaryOutputArchive(*this);
+            Scalar nearestSquaredDistance
+                    = std::numeric_limits<Scalar>::infinity();
+
+            for (Eigen::Index j = 0; j < centroids.cols(); ++j)
+                if (j != i)
+                    nearestSquaredDistance
+                            = std::min(nearestSquaredDistance,
+                                       (centroids.col(i) - centroids.col(j))
+                                               .squaredNorm());
+
+            Scalar sigma = std::sqrt(nearestSquaredDistance);
+
+            if (!(sigma > Scalar(0)) || std::isinf(sigma))
+                sigma = meanDistance;
+
+            biases(i) = sigma > Scalar(0)
+                        ? Scalar(1) / (std::sqrt(Scalar(2)) * sigma)
+                        : Scalar(1);
         }
-        file.close();
+
+        resetStepData();
+        updateCentresSquaredNorms();
+        updateCentreTree();
     }
 
+    //----------------------------------------------------------- | Locality <<<
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::setOutputTolerance
+            (double const tolerance)
+    {
+        outputTolerance = tolerance;
+        updateCentreTree();
+    }
+
+    template <typename Scalar>
+    double BasicRadialBasisFunctionLayer<Scalar>::getOutputTolerance
+            () const
+    {
+        return outputTolerance;
+    }
 
     //------------------------------------------------------------- | Traits <<<
-    int RadialBasisFunctionLayer::numberOfInputs
+    template <typename Scalar>
+    int BasicRadialBasisFunctionLayer<Scalar>::numberOfInputs
             () const
     {
         return weights.cols();
     }
 
-    int RadialBasisFunctionLayer::numberOfOutputs
+    template <typename Scalar>
+    int BasicRadialBasisFunctionLayer<Scalar>::numberOfOutputs
             () const
     {
         return weights.rows();
     }
 
     //--------------------------------------------------- | Helper functions <<<
-    void RadialBasisFunctionLayer::applyAverageOfDeltaStepsToMomentumStep
+    template <typename Scalar>
+    void
+    BasicRadialBasisFunctionLayer<Scalar>::applyAverageOfDeltaStepsToMomentumStep
             (double const learningCoefficient,
              double const momentumCoefficient)
     {
@@ -340,15 +524,20 @@ namespace NeuralNetworks
                     * deltaBiases;
     }
 
-    void RadialBasisFunctionLayer::applyMomentumStepToWeightsAndBiases
+    template <typename Scalar>
+    void
+    BasicRadialBasisFunctionLayer<Scalar>::applyMomentumStepToWeightsAndBiases
             ()
     {
         weights.noalias() += momentumWeights;
+        updateCentresSquaredNorms();
 
         biases.noalias() += momentumBiases;
+        updateCentreTree();
     }
 
-    void RadialBasisFunctionLayer::resetStepData
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::resetStepData
             ()
     {
         currentNumberOfSteps = 0;
@@ -359,6 +548,160 @@ namespace NeuralNetworks
         deltaBiases.setZero();
         momentumBiases.setZero();
     }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::calculateSquaredDistancesBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixMutableReference<Scalar> squaredDistances) const
+    {
+        squaredDistances.noalias() = Scalar(-2) * weights * inputs;
+        squaredDistances.colwise() += centresSquaredNorms;
+        squaredDistances.rowwise() += inputs.colwise().squaredNorm();
+
+        // Cancellation may leave tiny negatives for inputs on a centre
+        squaredDistances = squaredDistances.cwiseMax(Scalar(0));
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::calculateScaledErrorsBatch
+            (MatrixReference<Scalar> const &weightedErrors,
+             MatrixReference<Scalar> const &outputs) const
+    {
+        // Only reallocates when the batch's shape changes
+        scaledErrors.resize(weightedErrors.rows(), weightedErrors.cols());
+
+        scaledErrors.array() = (weightedErrors.array()
+                                * outputs.array()).colwise()
+                               * biases.array().square();
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::updateCentresSquaredNorms
+            ()
+    {
+        centresSquaredNorms = weights.rowwise().squaredNorm();
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::updateCentreTree
+            ()
+    {
+        isCentreTreeStale = false;
+
+        if (outputTolerance <= 0.0)
+        {
+            centreTree = {};
+            return;
+        }
+
+        // exp(-b_i^2 r_i^2) drops below the tolerance beyond
+        // r_i = sqrt(-ln(tolerance)) / |b_i|, and never for b_i = 0
+        Scalar const scaledRadius
+                = std::sqrt(-std::log(std::min(outputTolerance, 1.0)));
+
+        Vector<Scalar> const radii
+                = (biases.array() == Scalar(0))
+                        .select(std::numeric_limits<Scalar>::infinity(),
+                                scaledRadius / biases.array().abs());
+
+        centreTree = BasicCentreTree<Scalar>(weights, radii);
+    }
+
+    template <typename Scalar>
+    bool BasicRadialBasisFunctionLayer<Scalar>::isCentreTreeUsable
+            () const
+    {
+        return outputTolerance > 0.0 && !isCentreTreeStale;
+    }
+
+    template <typename Scalar>
+    std::vector<int> &BasicRadialBasisFunctionLayer<Scalar>::threadCentres
+            ()
+    {
+        thread_local std::vector<int> centres;
+
+        return centres;
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::calculateOutputsLocalBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixMutableReference<Scalar> outputs) const
+    {
+        std::vector<int> &centres = threadCentres();
+        outputs.setZero();
+
+        for (Eigen::Index k = 0; k < inputs.cols(); ++k)
+        {
+            centreTree.findCentresReaching(inputs.col(k), centres);
+
+            for (int const i : centres)
+                outputs(i, k)
+                        = std::exp(-biases(i) * biases(i)
+                                   * (inputs.col(k)
+                                      - weights.row(i).transpose())
+                                           .squaredNorm());
+        }
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::backpropagateLocalBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixReference<Scalar> const &weightedErrors,
+             MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> backpropagatedErrors) const
+    {
+        std::vector<int> &centres = threadCentres();
+        backpropagatedErrors.setZero();
+
+        for (Eigen::Index k = 0; k < inputs.cols(); ++k)
+        {
+            centreTree.findCentresReaching(inputs.col(k), centres);
+
+            for (int const i : centres)
+                backpropagatedErrors.col(k)
+                        -= Scalar(2)
+                           * weightedErrors(i, k) * outputs(i, k)
+                           * biases(i) * biases(i)
+                           * (inputs.col(k) - weights.row(i).transpose());
+        }
+    }
+
+    template <typename Scalar>
+    void BasicRadialBasisFunctionLayer<Scalar>::calculateNextStepLocalBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixReference<Scalar> const &weightedErrors,
+             MatrixReference<Scalar> const &outputs)
+    {
+        std::vector<int> &centres = threadCentres();
+
+        for (Eigen::Index k = 0; k < inputs.cols(); ++k)
+        {
+            centreTree.findCentresReaching(inputs.col(k), centres);
+
+            for (int const i : centres)
+            {
+                // Expression, evaluated in place by both uses
+                auto const difference
+                        = inputs.col(k).transpose() - weights.row(i);
+                Scalar const scaledError
+                        = weightedErrors(i, k) * outputs(i, k);
+
+                deltaWeights.row(i)
+                        += Scalar(2) * scaledError * biases(i) * biases(i)
+                           * difference;
+                deltaBiases(i)
+                        -= Scalar(2) * scaledError * biases(i)
+                           * difference.squaredNorm();
+            }
+        }
+
+        currentNumberOfSteps += inputs.cols();
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicRadialBasisFunctionLayer<float>;
+    template class BasicRadialBasisFunctionLayer<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
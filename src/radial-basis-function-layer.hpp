@@ -2,6 +2,7 @@
 #define IAD_2A_RADIAL_BASIS_FUNCTION_LAYER_HPP
 ///////////////////////////////////////////////////////////////////// | Includes
 #include "activation-function.hpp"
+#include "centre-tree.hpp"
 #include "sigmoid.hpp"
 #include "rectified-linear-unit.hpp"
 #include "training-example.hpp"
@@ -21,76 +22,86 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    //////////////////////////////////////// | Class: RadialBasisFunctionLayer <
-    class RadialBasisFunctionLayer
-            : public NeuralNetworkLayer
+    /////////////////////////////////// | Class: BasicRadialBasisFunctionLayer <
+    template <typename Scalar>
+    class BasicRadialBasisFunctionLayer final
+            : public BasicNeuralNetworkLayer<Scalar>
     {
     public:
 
-        Eigen::VectorXd getBiases()
+        Eigen::VectorX<Scalar> getBiases() const
         {
             return biases;
         }
-        void setWeights(Eigen::MatrixXd const &w)
+        void setWeights(Eigen::MatrixX<Scalar> const &w)
         {
             weights = w;
+            updateCentresSquaredNorms();
+            updateCentreTree();
         }
-        Eigen::MatrixXd getWeights()
+        Eigen::MatrixX<Scalar> getWeights() const
         {
             return weights;
         }
+        void setBiases(Eigen::VectorX<Scalar> const &b)
+        {
+            biases = b;
+            updateCentreTree();
+        }
         //========================================================= | Methods <<
         //------------------------------------------------- | Static methods <<<
         static void initialiseRandomNumberGenerator
                 (int seed);
 
         //--------------------------------------------------- | Constructors <<<
-        RadialBasisFunctionLayer
+        BasicRadialBasisFunctionLayer
                 ();
 
-        explicit RadialBasisFunctionLayer
+        explicit BasicRadialBasisFunctionLayer
                 (int numberOfInputs,
                  int numberOfOutputs,
-                 ActivationFunction const &activationFunction = Identity {});
+                 BasicActivationFunction<Scalar> const &activationFunction
+                 = BasicIdentity<Scalar> {});
 
-        explicit RadialBasisFunctionLayer
+        explicit BasicRadialBasisFunctionLayer
                 (std::string const &filename);
 
-        RadialBasisFunctionLayer
-                (RadialBasisFunctionLayer const &);
+        BasicRadialBasisFunctionLayer
+                (BasicRadialBasisFunctionLayer const &);
 
         //-------------------------- | Interface: Cloneable | Implementation <<<
-        std::unique_ptr<NeuralNetworkLayer> clone
+        std::unique_ptr<BasicNeuralNetworkLayer<Scalar>> clone
                 () const final;
 
         //------------------------------------------------------ | Operators <<<
-        Eigen::VectorXd operator()
-                (Eigen::VectorXd const &inputs) const override;
+        Eigen::VectorX<Scalar> operator()
+                (Eigen::VectorX<Scalar> const &inputs) const override;
 
         //------------------------------------------------- | Main behaviour <<<
-        Eigen::VectorXd calculateOutputs
-                (Eigen::VectorXd const &inputs) const override;
+        Eigen::VectorX<Scalar> calculateOutputs
+                (Eigen::VectorX<Scalar> const &inputs) const override;
 
-        Eigen::VectorXd activate
-                (Eigen::VectorXd const &outputs) const override;
+        Eigen::VectorX<Scalar> activate
+                (Eigen::VectorX<Scalar> const &outputs) const override;
 
-        Eigen::VectorXd calculateOutputsDerivative
-                (Eigen::VectorXd const &outputs) const override;
+        Eigen::VectorX<Scalar> calculateOutputsDerivative
+                (Eigen::VectorX<Scalar> const &outputs) const override;
 
-        Eigen::VectorXd feedForward
-                (Eigen::VectorXd const &inputs) const override;
+        Eigen::VectorX<Scalar> feedForward
+                (Eigen::VectorX<Scalar> const &inputs) const override;
 
-        Eigen::VectorXd backpropagate
-                (Eigen::VectorXd const &inputs,
-                 Eigen::VectorXd const &errors,
-                 Eigen::VectorXd const &outputs,
-                 Eigen::VectorXd const &outputsDerivative) const override;
+        Eigen::VectorX<Scalar> backpropagate
+                (Eigen::VectorX<Scalar> const &inputs,
+                 Eigen::VectorX<Scalar> const &errors,
+                 Eigen::VectorX<Scalar> const &outputs,
+                 Eigen::VectorX<Scalar> const &outputsDerivative)
+                const override;
 
         void calculateNextStep
-                (Eigen::VectorXd const &inputs,
-                 Eigen::VectorXd const &errors,
-                 Eigen::VectorXd const &outputs,
-                 Eigen::VectorXd const &outputsDerivative) override;
+                (Eigen::VectorX<Scalar> const &inputs,
+                 Eigen::VectorX<Scalar> const &errors,
+                 Eigen::VectorX<Scalar> const &outputs,
+                 Eigen::VectorX<Scalar> const &outputsDerivative) override;
 
         void update
                 (double learningCoefficient,
@@ -99,6 +110,79 @@ namespace NeuralNetworks
         void saveToFile
                 (std::string const &filename) const override;
 
+        //---------------------------------------------------------- | Batch <<<
+        void calculateOutputsBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputs) const override;
+
+        void activateBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> activatedOutputs)
+                const override;
+
+        void calculateOutputsDerivativeBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputsDerivative)
+                const override;
+
+        void activateWithDerivativeBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> activatedOutputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputsDerivative)
+                const override;
+
+        void backpropagateBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> backpropagatedErrors)
+                const override;
+
+        void calculateNextStepBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs)
+                override;
+
+        //---------------------------------------------- | Parallel training <<<
+        void synchroniseParameters
+                (BasicNeuralNetworkLayer<Scalar> const &layer) override;
+
+        void accumulateSteps
+                (BasicNeuralNetworkLayer<Scalar> &layer) override;
+
+        void applyStepsTo
+                (BasicNeuralNetworkLayer<Scalar> &layer,
+                 double learningCoefficient,
+                 double momentumCoefficient) override;
+
+        void beginAsynchronousSteps
+                () override;
+
+        void endAsynchronousSteps
+                () override;
+
+        //------------------------------------------------- | Initialisation <<<
+        // Places the centres on k-means++ centroids of the examples' inputs
+        // and sets every width b_i = 1 / (sqrt(2) sigma_i), with sigma_i the
+        // distance to the nearest other centroid. Meant to be called before
+        // training, instead of relying on the random initial centres.
+        void initialiseCentres
+                (std::vector<BasicTrainingExample<Scalar>> const &examples,
+                 int maximumNumberOfIterations = 100,
+                 int numberOfThreads = 1);
+
+        //------------------------------------------------------- | Locality <<<
+        // Outputs below the tolerance are treated as 0, so only centres within
+        // r_i = sqrt(-ln(tolerance)) / |b_i| of an input are visited. They
+        // are found through a kd-tree rebuilt after every update. A tolerance
+        // of 0, the default, visits every centre.
+        void setOutputTolerance
+                (double tolerance);
+
+        double getOutputTolerance
+                () const;
+
         //--------------------------------------------------------- | Traits <<<
         int numberOfInputs
                 () const override;
@@ -108,11 +192,25 @@ namespace NeuralNetworks
 
     private:
         //============================================================ | Data <<
-        Eigen::MatrixXd weights, deltaWeights, momentumWeights;
-        Eigen::VectorXd biases, deltaBiases, momentumBiases;
-        std::unique_ptr<ActivationFunction> activationFunction;
+        Eigen::MatrixX<Scalar> weights, deltaWeights, momentumWeights;
+        Eigen::VectorX<Scalar> biases, deltaBiases, momentumBiases;
+        std::unique_ptr<BasicActivationFunction<Scalar>> activationFunction;
         int currentNumberOfSteps;
 
+        // ||w_i||^2 of every centre, kept in step with the weights
+        Eigen::VectorX<Scalar> centresSquaredNorms;
+
+        double outputTolerance = 0.0;
+        BasicCentreTree<Scalar> centreTree;
+
+        // Set while asynchronous training moves the centres under the tree,
+        // which can't be rebuilt while other threads read it
+        bool isCentreTreeStale = false;
+
+        // Scratch of the gradients, kept between batches so that training
+        // does not allocate. Only the thread training the layer touches it.
+        mutable Eigen::MatrixX<Scalar> scaledErrors;
+
         //======================================================= | Behaviour <<
         //-------------------------------------------------- | Serialization <<<
         friend class cereal::access;
@@ -135,9 +233,55 @@ namespace NeuralNetworks
                     biases, deltaBiases, momentumBiases,
                     activationFunction,
                     currentNumberOfSteps);
+
+            updateCentresSquaredNorms();
+            updateCentreTree();
         }
 
         //----------------------------------------------- | Helper functions <<<
+        // ||x - w_i||^2 for every centre and input column, expanded as
+        // ||x||^2 - 2 w_i.x + ||w_i||^2 so that all of them come from a
+        // single matrix product
+        void calculateSquaredDistancesBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> squaredDistances) const;
+
+        // Sets scaledErrors to e_ik o_ik b_i^2, common to the gradients of
+        // inputs and centres
+        void calculateScaledErrorsBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs) const;
+
+        void updateCentresSquaredNorms
+                ();
+
+        void updateCentreTree
+                ();
+
+        bool isCentreTreeUsable
+                () const;
+
+        // Indices of the centres reaching an input, reused by every local
+        // batch the thread runs, whichever layer runs it
+        static std::vector<int> &threadCentres
+                ();
+
+        void calculateOutputsLocalBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputs) const;
+
+        void backpropagateLocalBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> backpropagatedErrors)
+                const;
+
+        void calculateNextStepLocalBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs);
+
         void applyAverageOfDeltaStepsToMomentumStep
                 (double learningCoefficient,
                  double momentumCoefficient);
@@ -147,35 +291,10 @@ namespace NeuralNetworks
 
         void resetStepData
                 ();
-
-
-        double calculateDerivativeOfOutputWithRespectToInput(
-                double const input,
-                double const output,
-                double const weight,
-                double const bias) const;
-
-        double calculateDerivativeOfCostWithRespectToOutput(double const
-        error) const;
-        double calculateDerivativeOfCostWithRespectToInput
-                (double const input,
-                 Vector const &weights,
-                 Vector const &errors,
-                 Vector const &outputs,
-                 Vector const &outputsDerivative) const;
-
-        double calculateDerivativeOfOutputWithRespectToWeight(
-                double const input,
-                double const output,
-                double const weight,
-                double const bias) const;
-
-        double calculateDerivativeOfOutputWithRespectToBias(
-                Vector const &inputs,
-                double const output,
-                Vector const &weights,
-                double const bias) const;
     };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using RadialBasisFunctionLayer = BasicRadialBasisFunctionLayer<double>;
 }
 
 //////////////////////////////////////// | cereal: Polymorphic type registration
@@ -183,5 +302,10 @@ CEREAL_REGISTER_TYPE(NeuralNetworks::RadialBasisFunctionLayer)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(NeuralNetworks::NeuralNetworkLayer,
                                      NeuralNetworks::RadialBasisFunctionLayer)
 
+CEREAL_REGISTER_TYPE(NeuralNetworks::BasicRadialBasisFunctionLayer<float>)
+CEREAL_REGISTER_POLYMORPHIC_RELATION
+        (NeuralNetworks::BasicNeuralNetworkLayer<float>,
+         NeuralNetworks::BasicRadialBasisFunctionLayer<float>)
+
 ////////////////////////////////////////////////////////////////////////////////
 #endif // IAD_2A_RADIAL_BASIS_FUNCTION_LAYER_HPP
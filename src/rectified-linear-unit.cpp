@@ -1,33 +1,92 @@
 ///////////////////////////////////////////////////////////////////// | Includes
 #include "rectified-linear-unit.hpp"
+#include "activation-kernels.hpp"
 
 /////////////////////////////////////////////////////////// | Using declarations
-using Array = Eigen::ArrayXd;
+template <typename Scalar>
+using Array = Eigen::ArrayX<Scalar>;
+
+template <typename Scalar>
+using Array2DReference = Eigen::Ref<Eigen::ArrayXX<Scalar> const>;
+
+template <typename Scalar>
+using Array2DMutableReference = Eigen::Ref<Eigen::ArrayXX<Scalar>>;
 
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    ///////////////////////////////////////////// | Class: RectifiedLinearUnit <
+    //////////////////////////////////////// | Class: BasicRectifiedLinearUnit <
     //============================================================= | Methods <<
     //-------------------------------- | Interface implementation: Cloneable <<<
-    std::unique_ptr<ActivationFunction> RectifiedLinearUnit::clone
+    template <typename Scalar>
+    std::unique_ptr<BasicActivationFunction<Scalar>>
+    BasicRectifiedLinearUnit<Scalar>::clone
             () const
     {
-        return std::make_unique<RectifiedLinearUnit>(*this);
+        return std::make_unique<BasicRectifiedLinearUnit>(*this);
     }
 
     //----------------------- | Interface implementation: ActivationFunction <<<
-    Array RectifiedLinearUnit::operator()
-            (Array const &inputs) const
+    template <typename Scalar>
+    Array<Scalar> BasicRectifiedLinearUnit<Scalar>::operator()
+            (Array<Scalar> const &inputs) const
+    {
+        Array<Scalar> outputs(inputs.size());
+        ActivationKernels::rectifiedLinearUnit<Scalar>
+                (inputs.data(), outputs.data(), nullptr, inputs.size());
+        return outputs;
+    }
+
+    template <typename Scalar>
+    Array<Scalar> BasicRectifiedLinearUnit<Scalar>::derivative
+            (Array<Scalar> const &inputs) const
+    {
+        Array<Scalar> derivatives(inputs.size());
+        ActivationKernels::rectifiedLinearUnit<Scalar>
+                (inputs.data(), nullptr, derivatives.data(), inputs.size());
+        return derivatives;
+    }
+
+    template <typename Scalar>
+    void BasicRectifiedLinearUnit<Scalar>::activateBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> outputs) const
+    {
+        ActivationKernels::apply<Scalar>
+                (ActivationKernels::rectifiedLinearUnit<Scalar>,
+                 inputs,
+                 &outputs,
+                 nullptr);
+    }
+
+    template <typename Scalar>
+    void BasicRectifiedLinearUnit<Scalar>::derivativeBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> derivatives) const
     {
-        return inputs.max(0.0);
+        ActivationKernels::apply<Scalar>
+                (ActivationKernels::rectifiedLinearUnit<Scalar>,
+                 inputs,
+                 nullptr,
+                 &derivatives);
     }
 
-    Array RectifiedLinearUnit::derivative
-            (Array const &inputs) const
+    template <typename Scalar>
+    void BasicRectifiedLinearUnit<Scalar>::activateWithDerivativeBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> outputs,
+             Array2DMutableReference<Scalar> derivatives) const
     {
-        return this->operator()(inputs).sign();
+        ActivationKernels::apply<Scalar>
+                (ActivationKernels::rectifiedLinearUnit<Scalar>,
+                 inputs,
+                 &outputs,
+                 &derivatives);
     }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicRectifiedLinearUnit<float>;
+    template class BasicRectifiedLinearUnit<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -6,44 +6,61 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    ///////////////////////////////////////////// | Class: RectifiedLinearUnit <
-    class RectifiedLinearUnit
-            : public ActivationFunction
+    //////////////////////////////////////// | Class: BasicRectifiedLinearUnit <
+    template <typename Scalar>
+    class BasicRectifiedLinearUnit final
+            : public BasicActivationFunction<Scalar>
     {
     public:
         //========================================================= | Methods <<
         //--------------------------------------------------- | Constructors <<<
-        RectifiedLinearUnit
+        BasicRectifiedLinearUnit
                 () = default;
 
-        RectifiedLinearUnit
-                (RectifiedLinearUnit const &) = default;
+        BasicRectifiedLinearUnit
+                (BasicRectifiedLinearUnit const &) = default;
 
-        RectifiedLinearUnit
-                (RectifiedLinearUnit &&) = default;
+        BasicRectifiedLinearUnit
+                (BasicRectifiedLinearUnit &&) = default;
 
         //------------------------------------------------------ | Operators <<<
-        RectifiedLinearUnit &operator=
-                (RectifiedLinearUnit const &) = default;
+        BasicRectifiedLinearUnit &operator=
+                (BasicRectifiedLinearUnit const &) = default;
 
-        RectifiedLinearUnit &operator=
-                (RectifiedLinearUnit &&) = default;
+        BasicRectifiedLinearUnit &operator=
+                (BasicRectifiedLinearUnit &&) = default;
 
         //----------------------------------------------------- | Destructor <<<
-        ~RectifiedLinearUnit
+        ~BasicRectifiedLinearUnit
                 () noexcept override = default;
 
         //---------------------------- | Interface implementation: Cloneable <<<
-        std::unique_ptr<ActivationFunction> clone
+        std::unique_ptr<BasicActivationFunction<Scalar>> clone
                 () const override;
 
         //------------------- | Interface implementation: ActivationFunction <<<
-        Eigen::ArrayXd operator()
-                (Eigen::ArrayXd const &input) const override;
+        Eigen::ArrayX<Scalar> operator()
+                (Eigen::ArrayX<Scalar> const &input) const override;
 
-        Eigen::ArrayXd derivative
-                (Eigen::ArrayXd const &input) const override;
+        Eigen::ArrayX<Scalar> derivative
+                (Eigen::ArrayX<Scalar> const &input) const override;
+
+        void activateBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs) const override;
+
+        void derivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const override;
+
+        void activateWithDerivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const override;
     };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using RectifiedLinearUnit = BasicRectifiedLinearUnit<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,311 @@
+#ifndef IAD_2A_SEARCH_TREE_HPP
+#define IAD_2A_SEARCH_TREE_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "index-file.hpp"
+#include "neighbour-heap.hpp"
+
+#include <Eigen/Eigen>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////////////////// | Class: SearchTree <
+    // Nodes of the binary trees of KdTree, BallTree and BasicCentreTree, and
+    // the order of their points, so that every node covers a range of it.
+    // Node has begin, end, left and right, children being -1 in leaves, and
+    // whatever the tree bounds its points with besides. The trees keep their
+    // own bounds and pass them to the building and the search as policies.
+    // Built trees own their arrays, trees read from an index file point
+    // into its mapping.
+    template <typename Node>
+    class SearchTree final
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        SearchTree
+                () = default;
+
+        // Points in their own order, until build is called
+        SearchTree
+                (int const numberOfDimensions,
+                 int const numberOfPoints,
+                 int const leafSize)
+                :
+                leafSize { std::max(leafSize, 1) },
+                numberOfDimensions { numberOfDimensions },
+                numberOfPoints { numberOfPoints },
+                ownedOrder(numberOfPoints)
+        {
+            std::iota(ownedOrder.begin(), ownedOrder.end(), 0);
+
+            order = ownedOrder.data();
+        }
+
+        // Maps a tree written by writeToFile, which has to outlive it
+        explicit SearchTree
+                (MappedIndexFile &file)
+                :
+                leafSize { file.read<int>() },
+                numberOfDimensions { file.read<int>() }
+        {
+            std::size_t size;
+
+            order = file.readArray<int>(size);
+            numberOfPoints = static_cast<int>(size);
+
+            nodes = file.readArray<Node>(size);
+            numberOfNodes = static_cast<int>(size);
+        }
+
+        // Copies of built trees own copies of the arrays, copies of mapped
+        // ones point into the same mapping
+        SearchTree
+                (SearchTree const &tree)
+                :
+                leafSize { tree.leafSize },
+                numberOfDimensions { tree.numberOfDimensions },
+                numberOfPoints { tree.numberOfPoints },
+                numberOfNodes { tree.numberOfNodes },
+                ownedOrder { tree.ownedOrder },
+                ownedNodes { tree.ownedNodes },
+                order { tree.isMapped() ? tree.order : ownedOrder.data() },
+                nodes { tree.isMapped() ? tree.nodes : ownedNodes.data() }
+        {
+        }
+
+        SearchTree
+                (SearchTree &&) = default;
+
+        SearchTree &operator=
+                (SearchTree const &tree)
+        {
+            return *this = SearchTree { tree };
+        }
+
+        SearchTree &operator=
+                (SearchTree &&) = default;
+
+        //----------------------------------------------------------- | Main <<<
+        // Splits every node at the median of a key of its points, which
+        // keeps the depth logarithmic and so bounds the traversal stacks.
+        // boundNode(node, index) records the bounds of a node once its range
+        // is set, and splitKey(node, index) returns the key of the node's
+        // points, a function of their index.
+        template <typename BoundNode, typename SplitKey>
+        void build
+                (BoundNode const &boundNode,
+                 SplitKey const &splitKey)
+        {
+            ownedNodes.reserve(maximumNumberOfNodes());
+
+            if (numberOfPoints > 0)
+                buildNode(0, numberOfPoints, boundNode, splitKey);
+
+            numberOfNodes = static_cast<int>(ownedNodes.size());
+            nodes = ownedNodes.data();
+        }
+
+        // Pushes the nearest points into neighbours, best node first, the
+        // nearer child on top so that the bound tightens early.
+        // squaredDistanceToNode(index) bounds the squared distance from the
+        // query to the points of a node from below.
+        template <typename SquaredDistanceToNode>
+        void findNearest
+                (Eigen::Ref<Eigen::MatrixXd const> const &points,
+                 Eigen::Ref<Eigen::VectorXd const> const &query,
+                 NeighbourHeap &neighbours,
+                 SquaredDistanceToNode const &squaredDistanceToNode) const
+        {
+            if (numberOfNodes == 0)
+                return;
+
+            std::pair<int, double> pendingNodes[128];
+            int numberOfPendingNodes = 0;
+            pendingNodes[numberOfPendingNodes++]
+                    = { 0, squaredDistanceToNode(0) };
+
+            while (numberOfPendingNodes > 0)
+            {
+                auto const [index, distance]
+                        = pendingNodes[--numberOfPendingNodes];
+
+                if (distance >= neighbours.bound())
+                    continue;
+
+                Node const &node = nodes[index];
+
+                if (node.left < 0)
+                {
+                    for (int i = node.begin; i < node.end; ++i)
+                        neighbours.push
+                                ((points.col(order[i]) - query).squaredNorm(),
+                                 order[i]);
+
+                    continue;
+                }
+
+                double const leftDistance = squaredDistanceToNode(node.left);
+                double const rightDistance = squaredDistanceToNode(node.right);
+
+                if (leftDistance < rightDistance)
+                {
+                    pendingNodes[numberOfPendingNodes++]
+                            = { node.right, rightDistance };
+                    pendingNodes[numberOfPendingNodes++]
+                            = { node.left, leftDistance };
+                }
+                else
+                {
+                    pendingNodes[numberOfPendingNodes++]
+                            = { node.left, leftDistance };
+                    pendingNodes[numberOfPendingNodes++]
+                            = { node.right, rightDistance };
+                }
+            }
+        }
+
+        //--------------------------------------------------------- | Traits <<<
+        bool isEmpty
+                () const
+        {
+            return numberOfNodes == 0;
+        }
+
+        bool isMapped
+                () const
+        {
+            return order != ownedOrder.data();
+        }
+
+        // A binary tree with non-empty nodes has fewer than twice as many
+        // nodes as points, which sizes the bounds while building
+        int maximumNumberOfNodes
+                () const
+        {
+            return 2 * numberOfPoints;
+        }
+
+        int getNumberOfDimensions
+                () const
+        {
+            return numberOfDimensions;
+        }
+
+        int getNumberOfNodes
+                () const
+        {
+            return numberOfNodes;
+        }
+
+        int const *getOrder
+                () const
+        {
+            return order;
+        }
+
+        Node const *getNodes
+                () const
+        {
+            return nodes;
+        }
+
+        //-------------------------------------------------- | Serialization <<<
+        void writeToFile
+                (IndexFileWriter &file) const
+        {
+            file.write(leafSize);
+            file.write(numberOfDimensions);
+            file.writeArray(order, numberOfPoints);
+            file.writeArray(nodes, numberOfNodes);
+        }
+
+        // Bounds with one node per column, read after the tree
+        double const *readBounds
+                (MappedIndexFile &file) const
+        {
+            auto const bounds = file.readMatrix();
+
+            if (bounds.rows() != numberOfDimensions
+                || bounds.cols() != numberOfNodes)
+                throw std::runtime_error("Corrupt index file");
+
+            return bounds.data();
+        }
+
+        void writeBounds
+                (IndexFileWriter &file,
+                 double const *const bounds) const
+        {
+            file.writeMatrix(Eigen::Map<Eigen::MatrixXd const>
+                                     (bounds,
+                                      numberOfDimensions,
+                                      numberOfNodes));
+        }
+
+    private:
+        //============================================================ | Data <<
+        int leafSize = 32;
+        int numberOfDimensions = 0;
+        int numberOfPoints = 0;
+        int numberOfNodes = 0;
+
+        // Arrays of built trees, empty in mapped ones
+        std::vector<int> ownedOrder;
+        std::vector<Node> ownedNodes;
+
+        int const *order = nullptr;
+        Node const *nodes = nullptr;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        template <typename BoundNode, typename SplitKey>
+        int buildNode
+                (int const begin,
+                 int const end,
+                 BoundNode const &boundNode,
+                 SplitKey const &splitKey)
+        {
+            int const index = static_cast<int>(ownedNodes.size());
+
+            Node node {};
+            node.begin = begin;
+            node.end = end;
+            node.left = -1;
+            node.right = -1;
+
+            boundNode(node, index);
+            ownedNodes.push_back(node);
+
+            if (end - begin <= leafSize)
+                return index;
+
+            auto const key = splitKey(node, index);
+
+            int const middle = begin + (end - begin) / 2;
+            std::nth_element(ownedOrder.begin() + begin,
+                             ownedOrder.begin() + middle,
+                             ownedOrder.begin() + end,
+                             [&key](int const a, int const b)
+                             {
+                                 return key(a) < key(b);
+                             });
+
+            int const left = buildNode(begin, middle, boundNode, splitKey);
+            int const right = buildNode(middle, end, boundNode, splitKey);
+
+            ownedNodes[index].left = left;
+            ownedNodes[index].right = right;
+
+            return index;
+        }
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_SEARCH_TREE_HPP
@@ -1,33 +1,87 @@
 ///////////////////////////////////////////////////////////////////// | Includes
 #include "sigmoid.hpp"
+#include "activation-kernels.hpp"
 
 /////////////////////////////////////////////////////////// | Using declarations
-using Array = Eigen::ArrayXd;
+template <typename Scalar>
+using Array = Eigen::ArrayX<Scalar>;
+
+template <typename Scalar>
+using Array2DReference = Eigen::Ref<Eigen::ArrayXX<Scalar> const>;
+
+template <typename Scalar>
+using Array2DMutableReference = Eigen::Ref<Eigen::ArrayXX<Scalar>>;
 
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    ///////////////////////////////////////////////////////// | Class: Sigmoid <
+    //////////////////////////////////////////////////// | Class: BasicSigmoid <
     //=========================================================== | Behaviour <<
     //------------------------------ | Interface: Cloneable | Implementation <<<
-    std::unique_ptr<ActivationFunction> Sigmoid::clone
+    template <typename Scalar>
+    std::unique_ptr<BasicActivationFunction<Scalar>>
+    BasicSigmoid<Scalar>::clone
             () const
     {
-        return std::make_unique<Sigmoid>(*this);
+        return std::make_unique<BasicSigmoid>(*this);
     }
 
     //--------------------- | Interface: ActivationFunction | Implementation <<<
-    Array Sigmoid::operator()
-            (Array const &input) const
+    template <typename Scalar>
+    Array<Scalar> BasicSigmoid<Scalar>::operator()
+            (Array<Scalar> const &input) const
+    {
+        Array<Scalar> outputs(input.size());
+        ActivationKernels::sigmoid<Scalar>
+                (input.data(), outputs.data(), nullptr, input.size());
+        return outputs;
+    }
+
+    template <typename Scalar>
+    Array<Scalar> BasicSigmoid<Scalar>::derivative
+            (Array<Scalar> const &input) const
+    {
+        Array<Scalar> derivatives(input.size());
+        ActivationKernels::sigmoid<Scalar>
+                (input.data(), nullptr, derivatives.data(), input.size());
+        return derivatives;
+    }
+
+    template <typename Scalar>
+    void BasicSigmoid<Scalar>::activateBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> outputs) const
+    {
+        ActivationKernels::apply<Scalar>
+                (ActivationKernels::sigmoid<Scalar>,
+                 inputs,
+                 &outputs,
+                 nullptr);
+    }
+
+    template <typename Scalar>
+    void BasicSigmoid<Scalar>::derivativeBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> derivatives) const
     {
-        return 1.0 / (1.0 + (-input).exp());
+        ActivationKernels::apply<Scalar>
+                (ActivationKernels::sigmoid<Scalar>,
+                 inputs,
+                 nullptr,
+                 &derivatives);
     }
 
-    Array Sigmoid::derivative
-            (Array const &input) const
+    template <typename Scalar>
+    void BasicSigmoid<Scalar>::activateWithDerivativeBatch
+            (Array2DReference<Scalar> const &inputs,
+             Array2DMutableReference<Scalar> outputs,
+             Array2DMutableReference<Scalar> derivatives) const
     {
-        Array sigmoidOutput = (*this)(input);
-        return sigmoidOutput * (1.0 - sigmoidOutput);
+        ActivationKernels::apply<Scalar>
+                (ActivationKernels::sigmoid<Scalar>,
+                 inputs,
+                 &outputs,
+                 &derivatives);
     }
 
     //---------------------------------------------- | cereal: Serialization <<<
@@ -42,6 +96,10 @@ namespace NeuralNetworks
 //            (Archive &archive)
 //    {
 //    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicSigmoid<float>;
+    template class BasicSigmoid<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
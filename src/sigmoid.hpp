@@ -9,43 +9,57 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    ///////////////////////////////////////////////////////// | Class: Sigmoid <
-    class Sigmoid final
-            : public ActivationFunction
+    //////////////////////////////////////////////////// | Class: BasicSigmoid <
+    template <typename Scalar>
+    class BasicSigmoid final
+            : public BasicActivationFunction<Scalar>
     {
     public:
         //======================================================= | Behaviour <<
         //--------------------------------------------------- | Constructors <<<
-        Sigmoid
+        BasicSigmoid
                 () = default;
 
-        Sigmoid
-                (Sigmoid const &) = default;
+        BasicSigmoid
+                (BasicSigmoid const &) = default;
 
-        Sigmoid
-                (Sigmoid &&) = default;
+        BasicSigmoid
+                (BasicSigmoid &&) = default;
 
         //------------------------------------------------------ | Operators <<<
-        Sigmoid &operator=
-                (Sigmoid const &) = default;
+        BasicSigmoid &operator=
+                (BasicSigmoid const &) = default;
 
-        Sigmoid &operator=
-                (Sigmoid &&) = default;
+        BasicSigmoid &operator=
+                (BasicSigmoid &&) = default;
 
         //----------------------------------------------------- | Destructor <<<
-        ~Sigmoid
+        ~BasicSigmoid
                 () noexcept final = default;
 
         //-------------------------- | Interface: Cloneable | Implementation <<<
-        std::unique_ptr<ActivationFunction> clone
+        std::unique_ptr<BasicActivationFunction<Scalar>> clone
                 () const final;
 
         //----------------- | Interface: ActivationFunction | Implementation <<<
-        Eigen::ArrayXd operator()
-                (Eigen::ArrayXd const &input) const final;
+        Eigen::ArrayX<Scalar> operator()
+                (Eigen::ArrayX<Scalar> const &input) const final;
 
-        Eigen::ArrayXd derivative
-                (Eigen::ArrayXd const &input) const final;
+        Eigen::ArrayX<Scalar> derivative
+                (Eigen::ArrayX<Scalar> const &input) const final;
+
+        void activateBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs) const final;
+
+        void derivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const final;
+
+        void activateWithDerivativeBatch
+                (Eigen::Ref<Eigen::ArrayXX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> outputs,
+                 Eigen::Ref<Eigen::ArrayXX<Scalar>> derivatives) const final;
 
     private:
         //======================================================= | Behaviour <<
@@ -64,12 +78,20 @@ namespace NeuralNetworks
         {
         }
     };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using Sigmoid = BasicSigmoid<double>;
 }
 
 //////////////////////////////////////// | cereal: Polymorphic type registration
 CEREAL_REGISTER_TYPE(NeuralNetworks::Sigmoid)
+CEREAL_REGISTER_TYPE(NeuralNetworks::BasicSigmoid<float>)
+
 CEREAL_REGISTER_POLYMORPHIC_RELATION(NeuralNetworks::ActivationFunction,
                                      NeuralNetworks::Sigmoid)
+CEREAL_REGISTER_POLYMORPHIC_RELATION
+        (NeuralNetworks::BasicActivationFunction<float>,
+         NeuralNetworks::BasicSigmoid<float>)
 
 ////////////////////////////////////////////////////////////////////////////////
 #endif // IAD_2A_SIGMOID_HPP
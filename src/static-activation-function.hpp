@@ -0,0 +1,93 @@
+#ifndef IAD_2A_STATIC_ACTIVATION_FUNCTION_HPP
+#define IAD_2A_STATIC_ACTIVATION_FUNCTION_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "identity.hpp"
+#include "rectified-linear-unit.hpp"
+#include "sigmoid.hpp"
+
+#include <Eigen/Eigen>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    // Compile-time counterparts of the activation functions, used as policies
+    // of static layers so that activation is inlined into the layer's kernel
+
+    ////////////////////////////////////////////////// | Policy: StaticSigmoid <
+    struct StaticSigmoid final
+    {
+        // Activation function of dynamic layers computing the same
+        template <typename Scalar>
+        using Dynamic = BasicSigmoid<Scalar>;
+
+        template <typename Scalar, int Rows>
+        static Eigen::Array<Scalar, Rows, 1> activate
+                (Eigen::Array<Scalar, Rows, 1> const &inputs)
+        {
+            return Scalar(1) / (Scalar(1) + (-inputs).exp());
+        }
+
+        template <typename Scalar, int Rows>
+        static void activateWithDerivative
+                (Eigen::Array<Scalar, Rows, 1> const &inputs,
+                 Eigen::Array<Scalar, Rows, 1> &outputs,
+                 Eigen::Array<Scalar, Rows, 1> &derivatives)
+        {
+            outputs = Scalar(1) / (Scalar(1) + (-inputs).exp());
+            derivatives = outputs * (Scalar(1) - outputs);
+        }
+    };
+
+    ///////////////////////////////////////////////// | Policy: StaticIdentity <
+    struct StaticIdentity final
+    {
+        // Activation function of dynamic layers computing the same
+        template <typename Scalar>
+        using Dynamic = BasicIdentity<Scalar>;
+
+        template <typename Scalar, int Rows>
+        static Eigen::Array<Scalar, Rows, 1> activate
+                (Eigen::Array<Scalar, Rows, 1> const &inputs)
+        {
+            return inputs;
+        }
+
+        template <typename Scalar, int Rows>
+        static void activateWithDerivative
+                (Eigen::Array<Scalar, Rows, 1> const &inputs,
+                 Eigen::Array<Scalar, Rows, 1> &outputs,
+                 Eigen::Array<Scalar, Rows, 1> &derivatives)
+        {
+            outputs = inputs;
+            derivatives.setOnes();
+        }
+    };
+
+    ////////////////////////////////////// | Policy: StaticRectifiedLinearUnit <
+    struct StaticRectifiedLinearUnit final
+    {
+        // Activation function of dynamic layers computing the same
+        template <typename Scalar>
+        using Dynamic = BasicRectifiedLinearUnit<Scalar>;
+
+        template <typename Scalar, int Rows>
+        static Eigen::Array<Scalar, Rows, 1> activate
+                (Eigen::Array<Scalar, Rows, 1> const &inputs)
+        {
+            return inputs.max(Scalar(0));
+        }
+
+        template <typename Scalar, int Rows>
+        static void activateWithDerivative
+                (Eigen::Array<Scalar, Rows, 1> const &inputs,
+                 Eigen::Array<Scalar, Rows, 1> &outputs,
+                 Eigen::Array<Scalar, Rows, 1> &derivatives)
+        {
+            outputs = inputs.max(Scalar(0));
+            derivatives = (inputs > Scalar(0)).template cast<Scalar>();
+        }
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif //IAD_2A_STATIC_ACTIVATION_FUNCTION_HPP
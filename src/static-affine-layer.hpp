@@ -0,0 +1,179 @@
+#ifndef IAD_2A_STATIC_AFFINE_LAYER_HPP
+#define IAD_2A_STATIC_AFFINE_LAYER_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "affine-layer.hpp"
+#include "affine-layer-steps.hpp"
+#include "static-activation-function.hpp"
+
+#include <Eigen/Eigen>
+#include <cmath>
+#include <stdexcept>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    /////////////////////////////////////////////// | Class: StaticAffineLayer <
+    // Affine layer with dimensions known at compile time. Parameters live in
+    // fixed-size matrices, so the layer never allocates and Eigen unrolls and
+    // vectorises its kernels. Training shares BasicAffineLayer's arithmetic.
+    template <typename Scalar,
+              int NumberOfInputs,
+              int NumberOfOutputs,
+              typename ActivationFunction>
+    class StaticAffineLayer final
+    {
+    public:
+        //=========================================================== | Types <<
+        using Inputs = Eigen::Matrix<Scalar, NumberOfInputs, 1>;
+        using Outputs = Eigen::Matrix<Scalar, NumberOfOutputs, 1>;
+        using Weights = Eigen::Matrix<Scalar, NumberOfOutputs, NumberOfInputs>;
+
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        explicit StaticAffineLayer
+                (bool const enableBias = true)
+                :
+                weights { std::sqrt(2.0 / (NumberOfInputs + NumberOfOutputs))
+                          * Weights::Random() },
+                deltaWeights { Weights::Zero() },
+                momentumWeights { Weights::Zero() },
+
+                biases { enableBias
+                         ? Outputs { std::sqrt(2.0 / (NumberOfInputs
+                                                      + NumberOfOutputs))
+                                     * Outputs::Random() }
+                         : Outputs { Outputs::Zero() } },
+                deltaBiases { Outputs::Zero() },
+                momentumBiases { Outputs::Zero() },
+
+                currentNumberOfSteps { 0 },
+                isBiasEnabled { enableBias }
+        {
+        }
+
+        // Copies parameters of a dynamic layer of the same shape, whose
+        // activation function has to match the policy, or throws
+        explicit StaticAffineLayer
+                (BasicAffineLayer<Scalar> const &layer)
+                :
+                weights { toWeights(layer) },
+                deltaWeights { Weights::Zero() },
+                momentumWeights { Weights::Zero() },
+
+                // A disabled bias is kept in the dynamic layer but not used
+                biases { layer.hasBiases()
+                         ? Outputs { layer.getBiases() }
+                         : Outputs { Outputs::Zero() } },
+                deltaBiases { Outputs::Zero() },
+                momentumBiases { Outputs::Zero() },
+
+                currentNumberOfSteps { 0 },
+                isBiasEnabled { layer.hasBiases() }
+        {
+        }
+
+        //----------------------------------------------------------- | Main <<<
+        Outputs feedForward
+                (Inputs const &inputs) const
+        {
+            Eigen::Array<Scalar, NumberOfOutputs, 1> const outputs
+                    = (weights * inputs + biases).array();
+
+            return ActivationFunction::activate(outputs).matrix();
+        }
+
+        // Keeps the activation's derivative for backpropagation
+        void feedForward
+                (Inputs const &inputs,
+                 Outputs &neurons,
+                 Outputs &neuronsDerivative) const
+        {
+            Eigen::Array<Scalar, NumberOfOutputs, 1> const outputs
+                    = (weights * inputs + biases).array();
+            Eigen::Array<Scalar, NumberOfOutputs, 1> activatedOutputs,
+                    outputsDerivative;
+
+            ActivationFunction::activateWithDerivative(outputs,
+                                                       activatedOutputs,
+                                                       outputsDerivative);
+
+            neurons = activatedOutputs.matrix();
+            neuronsDerivative = outputsDerivative.matrix();
+        }
+
+        Inputs backpropagate
+                (Outputs const &weightedErrors) const
+        {
+            return weights.transpose() * weightedErrors;
+        }
+
+        void calculateNextStep
+                (Inputs const &inputs,
+                 Outputs const &weightedErrors)
+        {
+            steps().calculateNextStep(inputs, weightedErrors);
+        }
+
+        void update
+                (double const learningCoefficient,
+                 double const momentumCoefficient)
+        {
+            steps().update(learningCoefficient, momentumCoefficient);
+        }
+
+        //--------------------------------------------------------- | Traits <<<
+        Weights const &getWeights
+                () const
+        {
+            return weights;
+        }
+
+        Outputs const &getBiases
+                () const
+        {
+            return biases;
+        }
+
+    private:
+        //============================================================ | Data <<
+        Weights weights, deltaWeights, momentumWeights;
+        Outputs biases, deltaBiases, momentumBiases;
+        int currentNumberOfSteps;
+        bool isBiasEnabled;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        static Weights toWeights
+                (BasicAffineLayer<Scalar> const &layer)
+        {
+            Eigen::MatrixX<Scalar> const layerWeights = layer.getWeights();
+
+            if (layerWeights.rows() != NumberOfOutputs
+                || layerWeights.cols() != NumberOfInputs)
+                throw std::invalid_argument("Mismatched layer shape");
+
+            if (!dynamic_cast<typename ActivationFunction
+                                      ::template Dynamic<Scalar> const *>
+                        (&layer.getActivationFunction()))
+                throw std::invalid_argument("Mismatched activation function");
+
+            return layerWeights;
+        }
+
+        AffineLayerSteps<Weights, Outputs> steps
+                ()
+        {
+            return { weights,
+                     deltaWeights,
+                     momentumWeights,
+                     biases,
+                     deltaBiases,
+                     momentumBiases,
+                     currentNumberOfSteps,
+                     isBiasEnabled };
+        }
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif //IAD_2A_STATIC_AFFINE_LAYER_HPP
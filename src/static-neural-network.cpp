@@ -0,0 +1,18 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "static-neural-network.hpp"
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    //============================================== | Explicit instantiation <<
+    // Static networks are templates on their shape, so only the common
+    // perceptron is instantiated here, to have the headers built with the
+    // project. Alias templates cannot be named in an explicit instantiation.
+    template class StaticAffineLayer<double, 1, 16, StaticSigmoid>;
+    template class StaticAffineLayer<double, 16, 1, StaticIdentity>;
+    template class StaticNeuralNetwork
+            <StaticAffineLayer<double, 1, 16, StaticSigmoid>,
+             StaticAffineLayer<double, 16, 1, StaticIdentity>>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
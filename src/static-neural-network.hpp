@@ -0,0 +1,245 @@
+#ifndef IAD_2A_STATIC_NEURAL_NETWORK_HPP
+#define IAD_2A_STATIC_NEURAL_NETWORK_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "neural-network.hpp"
+#include "static-affine-layer.hpp"
+#include "static-activation-function.hpp"
+#include "training-example.hpp"
+
+#include <Eigen/Eigen>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////////////////// | Class: StaticNeuralNetwork <
+    // Network of StaticAffineLayers, whose shape is fixed at compile time.
+    // Layers are kept in a tuple and walked by recursive templates, so every
+    // pass is unrolled into a single function with no virtual calls and no
+    // heap allocations. Results match NeuralNetwork with the same parameters.
+    template <typename... Layers>
+    class StaticNeuralNetwork final
+    {
+        static_assert(sizeof...(Layers) > 0,
+                      "A network needs at least one layer");
+
+    public:
+        //=========================================================== | Types <<
+        using Inputs
+                = typename std::tuple_element_t
+                        <0, std::tuple<Layers...>>::Inputs;
+
+        using Outputs
+                = typename std::tuple_element_t
+                        <sizeof...(Layers) - 1, std::tuple<Layers...>>::Outputs;
+
+        using Scalar = typename Inputs::Scalar;
+
+        using TrainingExample = BasicTrainingExample<Scalar>;
+
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        StaticNeuralNetwork
+                () = default;
+
+        // Copies parameters of a dynamic network made of affine layers
+        // of the same shapes and activation functions, or throws
+        explicit StaticNeuralNetwork
+                (BasicNeuralNetwork<Scalar> const &neuralNetwork)
+                :
+                layers { copyLayers(neuralNetwork,
+                                    std::index_sequence_for<Layers...> {}) }
+        {
+        }
+
+        //------------------------------------------------------ | Operators <<<
+        Outputs operator()
+                (Inputs const &inputs) const
+        {
+            return feedForward(inputs);
+        }
+
+        //----------------------------------------------------------- | Main <<<
+        Outputs feedForward
+                (Inputs const &inputs) const
+        {
+            return feedForwardFrom<0>(inputs);
+        }
+
+        // Trains on the examples in the given order and returns the epoch's
+        // cost, as reported by NeuralNetwork::train
+        double trainOnEpoch
+                (std::vector<TrainingExample> const &trainingExamples,
+                 double const learningCoefficient,
+                 double const momentumCoefficient = 0.0,
+                 int const batchSize = 1)
+        {
+            double cost = 0.0;
+
+            for (auto firstExample = trainingExamples.cbegin();
+                 firstExample != trainingExamples.cend();)
+            {
+                auto const lastExample
+                        = firstExample
+                          + std::min<std::ptrdiff_t>
+                                  (std::max(batchSize, 1),
+                                   trainingExamples.cend() - firstExample);
+
+                for (auto example = firstExample;
+                     example != lastExample;
+                     ++example)
+                {
+                    Inputs const inputs = example->inputs;
+                    Outputs const targets = example->outputs;
+
+                    cost += accumulateStepsFrom<0>(inputs, targets)
+                            / trainingExamples.size();
+                }
+
+                std::apply([&](auto &... layer)
+                           {
+                               (layer.update(learningCoefficient,
+                                             momentumCoefficient), ...);
+                           },
+                           layers);
+
+                firstExample = lastExample;
+            }
+
+            return cost;
+        }
+
+        // Mean cost over the examples, as NeuralNetwork::test's global cost
+        double test
+                (std::vector<TrainingExample> const &testingExamples) const
+        {
+            double cost = 0.0;
+
+            for (auto const &testingExample
+                    : testingExamples)
+            {
+                Inputs const inputs = testingExample.inputs;
+                Outputs const targets = testingExample.outputs;
+
+                cost += (targets - feedForward(inputs)).squaredNorm()
+                        / testingExamples.size();
+            }
+
+            return cost;
+        }
+
+        //--------------------------------------------------------- | Traits <<<
+        template <std::size_t Index>
+        auto const &layer
+                () const
+        {
+            return std::get<Index>(layers);
+        }
+
+    private:
+        //============================================================ | Data <<
+        std::tuple<Layers...> layers;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        template <std::size_t... Indices>
+        static std::tuple<Layers...> copyLayers
+                (BasicNeuralNetwork<Scalar> const &neuralNetwork,
+                 std::index_sequence<Indices...>)
+        {
+            if (neuralNetwork.layers.size() != sizeof...(Layers))
+                throw std::invalid_argument("Mismatched number of layers");
+
+            return std::tuple<Layers...>
+                    { Layers { toAffineLayer(*neuralNetwork.layers[Indices]) }
+                      ... };
+        }
+
+        static BasicAffineLayer<Scalar> const &toAffineLayer
+                (BasicNeuralNetworkLayer<Scalar> const &layer)
+        {
+            if (auto const affineLayer
+                        = dynamic_cast<BasicAffineLayer<Scalar> const *>
+                                (&layer))
+                return *affineLayer;
+
+            throw std::invalid_argument("Unsupported layer type");
+        }
+
+        template <std::size_t Index, typename LayerInputs>
+        Outputs feedForwardFrom
+                (LayerInputs const &inputs) const
+        {
+            if constexpr (Index + 1 == sizeof...(Layers))
+                return std::get<Index>(layers).feedForward(inputs);
+            else
+                return feedForwardFrom<Index + 1>
+                        (std::get<Index>(layers).feedForward(inputs));
+        }
+
+        // Runs forward through layer Index and the ones above it, then back,
+        // accumulating their steps. Returns the errors at the layer's inputs,
+        // or the example's cost for the first layer.
+        template <std::size_t Index, typename LayerInputs>
+        auto accumulateStepsFrom
+                (LayerInputs const &inputs,
+                 Outputs const &targets,
+                 Scalar *cost = nullptr)
+        {
+            auto &layer = std::get<Index>(layers);
+
+            typename std::tuple_element_t<Index, std::tuple<Layers...>>
+                    ::Outputs neurons, neuronsDerivative, weightedErrors;
+
+            layer.feedForward(inputs, neurons, neuronsDerivative);
+
+            Scalar exampleCost;
+            Scalar *const costOutput = Index == 0 ? &exampleCost : cost;
+
+            if constexpr (Index + 1 == sizeof...(Layers))
+            {
+                weightedErrors = targets - neurons;
+                *costOutput = weightedErrors.squaredNorm();
+            }
+            else
+                weightedErrors = accumulateStepsFrom<Index + 1>(neurons,
+                                                                targets,
+                                                                costOutput);
+
+            weightedErrors.array() *= neuronsDerivative.array();
+
+            layer.calculateNextStep(inputs, weightedErrors);
+
+            if constexpr (Index == 0)
+                return static_cast<double>(exampleCost);
+            else
+                return layer.backpropagate(weightedErrors);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    // Networks with a single hidden layer, the shape used for approximation
+    template <typename Scalar,
+              int NumberOfInputs,
+              int NumberOfHiddenNeurons,
+              int NumberOfOutputs,
+              typename HiddenActivationFunction = StaticSigmoid,
+              typename OutputActivationFunction = StaticIdentity>
+    using StaticPerceptron
+            = StaticNeuralNetwork<StaticAffineLayer<Scalar,
+                                                    NumberOfInputs,
+                                                    NumberOfHiddenNeurons,
+                                                    HiddenActivationFunction>,
+                                  StaticAffineLayer<Scalar,
+                                                    NumberOfHiddenNeurons,
+                                                    NumberOfOutputs,
+                                                    OutputActivationFunction>>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif //IAD_2A_STATIC_NEURAL_NETWORK_HPP
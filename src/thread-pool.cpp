@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "thread-pool.hpp"
+
+#include <algorithm>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////////////////// | Class: ThreadPool <
+    //============================================================= | Methods <<
+    //----------------------------------------------------- | Static methods <<<
+    int ThreadPool::defaultNumberOfThreads
+            ()
+    {
+        return std::max(1, static_cast<int>
+                (std::thread::hardware_concurrency()));
+    }
+
+    //------------------------------------------------------- | Constructors <<<
+    ThreadPool::ThreadPool
+            (int const numberOfThreads)
+            :
+            isStopping { false }
+    {
+        for (int i = 0;
+             i < std::max(1, numberOfThreads);
+             ++i)
+            threads.emplace_back(&ThreadPool::work, this);
+    }
+
+    //--------------------------------------------------------- | Destructor <<<
+    ThreadPool::~ThreadPool
+            () noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(tasksMutex);
+            isStopping = true;
+        }
+        tasksCondition.notify_all();
+
+        for (auto &thread
+                : threads)
+            thread.join();
+    }
+
+    //----------------------------------------------------- | Main behaviour <<<
+    void ThreadPool::parallelFor
+            (int const numberOfTasks,
+             std::function<void(int)> const &task)
+    {
+        std::vector<std::future<void>> results;
+
+        for (int i = 0;
+             i < numberOfTasks;
+             ++i)
+            results.emplace_back(submit([&task, i]() { task(i); }));
+
+        // Tasks refer to the caller's function, so all of them have to finish
+        // before the first exception (if any) is rethrown
+        for (auto &result
+                : results)
+            result.wait();
+
+        for (auto &result
+                : results)
+            result.get();
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    int ThreadPool::numberOfThreads
+            () const
+    {
+        return static_cast<int>(threads.size());
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    void ThreadPool::work
+            ()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(tasksMutex);
+                tasksCondition.wait(lock,
+                                    [this]()
+                                    {
+                                        return isStopping || !tasks.empty();
+                                    });
+
+                if (isStopping && tasks.empty())
+                    return;
+
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,98 @@
+#ifndef IAD_2A_THREAD_POOL_HPP
+#define IAD_2A_THREAD_POOL_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ////////////////////////////////////////////////////// | Class: ThreadPool <
+    class ThreadPool final
+    {
+    public:
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------------- | Static <<<
+        static int defaultNumberOfThreads
+                ();
+
+        //--------------------------------------------------- | Constructors <<<
+        explicit ThreadPool
+                (int numberOfThreads = defaultNumberOfThreads());
+
+        ThreadPool
+                (ThreadPool const &) = delete;
+
+        ThreadPool
+                (ThreadPool &&) = delete;
+
+        //------------------------------------------------------ | Operators <<<
+        ThreadPool &operator=
+                (ThreadPool const &) = delete;
+
+        ThreadPool &operator=
+                (ThreadPool &&) = delete;
+
+        //----------------------------------------------------- | Destructor <<<
+        ~ThreadPool
+                () noexcept;
+
+        //----------------------------------------------------------- | Main <<<
+        template <typename Function>
+        std::future<std::invoke_result_t<Function>> submit
+                (Function &&function);
+
+        // Runs task(0), ..., task(numberOfTasks - 1) on the pool and blocks
+        // until all of them are finished
+        void parallelFor
+                (int numberOfTasks,
+                 std::function<void(int)> const &task);
+
+        //--------------------------------------------------------- | Traits <<<
+        int numberOfThreads
+                () const;
+
+    private:
+        //============================================================ | Data <<
+        std::vector<std::thread> threads;
+        std::queue<std::function<void()>> tasks;
+        std::mutex tasksMutex;
+        std::condition_variable tasksCondition;
+        bool isStopping;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        void work
+                ();
+    };
+
+    //======================================== | Class: ThreadPool | Behaviour <<
+    //------------------------------------------------------------- | Main <<<
+    template <typename Function>
+    std::future<std::invoke_result_t<Function>> ThreadPool::submit
+            (Function &&function)
+    {
+        auto task = std::make_shared
+                <std::packaged_task<std::invoke_result_t<Function>()>>
+                (std::forward<Function>(function));
+
+        auto result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(tasksMutex);
+            tasks.emplace([task]() { (*task)(); });
+        }
+        tasksCondition.notify_one();
+
+        return result;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // IAD_2A_THREAD_POOL_HPP
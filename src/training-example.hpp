@@ -6,14 +6,18 @@
 //////////////////////////////////////////////////// | Namespace: NeuralNetworks
 namespace NeuralNetworks
 {
-    //////////////////////////////////////////////// | Struct: TrainingExample <
-    struct TrainingExample
+    /////////////////////////////////////////// | Struct: BasicTrainingExample <
+    template <typename Scalar>
+    struct BasicTrainingExample
     {
         //============================================================ | Data <<
         //-------------------------------------------------------- | Vectors <<<
-        Eigen::VectorXd inputs;
-        Eigen::VectorXd outputs;
+        Eigen::VectorX<Scalar> inputs;
+        Eigen::VectorX<Scalar> outputs;
     };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using TrainingExample = BasicTrainingExample<double>;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,238 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "variant-affine-layer.hpp"
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+/////////////////////////////////////////////////////////// | Using declarations
+template <typename Scalar>
+using Matrix = Eigen::MatrixX<Scalar>;
+
+template <typename Scalar>
+using Vector = Eigen::VectorX<Scalar>;
+
+template <typename Scalar>
+using MatrixReference = Eigen::Ref<Eigen::MatrixX<Scalar> const>;
+
+template <typename Scalar>
+using MatrixMutableReference = Eigen::Ref<Eigen::MatrixX<Scalar>>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////////////// | Class: BasicVariantAffineLayer <
+    //============================================================= | Methods <<
+    //------------------------------------------------------- | Constructors <<<
+    template <typename Scalar>
+    BasicVariantAffineLayer<Scalar>::BasicVariantAffineLayer
+            (int const numberOfInputs,
+             int const numberOfOutputs,
+             ActivationFunction activationFunction,
+             bool const enableBias)
+            :
+            weights { std::sqrt(2.0 / (numberOfInputs + numberOfOutputs))
+                      * Matrix<Scalar>::Random(numberOfOutputs,
+                                               numberOfInputs) },
+            deltaWeights { Matrix<Scalar>::Zero(numberOfOutputs,
+                                                numberOfInputs) },
+            momentumWeights { Matrix<Scalar>::Zero(numberOfOutputs,
+                                                   numberOfInputs) },
+
+            biases { std::sqrt(2.0 / (numberOfInputs + numberOfOutputs))
+                     * Vector<Scalar>::Random(numberOfOutputs) },
+            deltaBiases { Vector<Scalar>::Zero(numberOfOutputs) },
+            momentumBiases { Vector<Scalar>::Zero(numberOfOutputs) },
+
+            activationFunction { std::move(activationFunction) },
+            currentNumberOfSteps { 0 },
+            isBiasEnabled { enableBias }
+    {
+    }
+
+    template <typename Scalar>
+    BasicVariantAffineLayer<Scalar>::BasicVariantAffineLayer
+            (BasicAffineLayer<Scalar> const &layer)
+            :
+            weights { layer.getWeights() },
+            deltaWeights { Matrix<Scalar>::Zero(weights.rows(),
+                                                weights.cols()) },
+            momentumWeights { Matrix<Scalar>::Zero(weights.rows(),
+                                                   weights.cols()) },
+
+            biases { layer.getBiases() },
+            deltaBiases { Vector<Scalar>::Zero(biases.size()) },
+            momentumBiases { Vector<Scalar>::Zero(biases.size()) },
+
+            activationFunction
+                    { toActivationFunction(layer.getActivationFunction()) },
+            currentNumberOfSteps { 0 },
+            isBiasEnabled { layer.hasBiases() }
+    {
+    }
+
+    //-------------------------------------------------------------- | Batch <<<
+    template <typename Scalar>
+    void BasicVariantAffineLayer<Scalar>::calculateOutputsBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixMutableReference<Scalar> outputs) const
+    {
+        outputs.noalias() = weights * inputs;
+
+        if (isBiasEnabled)
+            outputs.colwise() += biases;
+    }
+
+    template <typename Scalar>
+    void BasicVariantAffineLayer<Scalar>::activateBatch
+            (MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> activatedOutputs) const
+    {
+        std::visit([&](auto const &activationFunction)
+                   {
+                       activationFunction.activateBatch
+                               (outputs.array(),
+                                activatedOutputs.array());
+                   },
+                   activationFunction);
+    }
+
+    template <typename Scalar>
+    void BasicVariantAffineLayer<Scalar>::activateWithDerivativeBatch
+            (MatrixReference<Scalar> const &outputs,
+             MatrixMutableReference<Scalar> activatedOutputs,
+             MatrixMutableReference<Scalar> outputsDerivative) const
+    {
+        std::visit([&](auto const &activationFunction)
+                   {
+                       activationFunction.activateWithDerivativeBatch
+                               (outputs.array(),
+                                activatedOutputs.array(),
+                                outputsDerivative.array());
+                   },
+                   activationFunction);
+    }
+
+    template <typename Scalar>
+    void BasicVariantAffineLayer<Scalar>::backpropagateBatch
+            (MatrixReference<Scalar> const &/*inputs*/,
+             MatrixReference<Scalar> const &weightedErrors,
+             MatrixReference<Scalar> const &/*outputs*/,
+             MatrixMutableReference<Scalar> backpropagatedErrors) const
+    {
+        backpropagatedErrors.noalias() = weights.transpose() * weightedErrors;
+    }
+
+    template <typename Scalar>
+    void BasicVariantAffineLayer<Scalar>::calculateNextStepBatch
+            (MatrixReference<Scalar> const &inputs,
+             MatrixReference<Scalar> const &weightedErrors,
+             MatrixReference<Scalar> const &/*outputs*/)
+    {
+        steps().calculateNextStep(inputs, weightedErrors);
+    }
+
+    template <typename Scalar>
+    void BasicVariantAffineLayer<Scalar>::update
+            (double const learningCoefficient,
+             double const momentumCoefficient)
+    {
+        steps().update(learningCoefficient, momentumCoefficient);
+    }
+
+    //-------------------------------------------------------- | Conversions <<<
+    template <typename Scalar>
+    std::unique_ptr<BasicNeuralNetworkLayer<Scalar>>
+    BasicVariantAffineLayer<Scalar>::toNeuralNetworkLayer
+            () const
+    {
+        auto layer = std::visit
+                ([&](auto const &activationFunction)
+                         -> std::unique_ptr<BasicAffineLayer<Scalar>>
+                 {
+                     if (isBiasEnabled)
+                         return std::make_unique
+                                 <BasicAffineLayerWithBias<Scalar>>
+                                 (numberOfInputs(),
+                                  numberOfOutputs(),
+                                  activationFunction);
+
+                     return std::make_unique
+                             <BasicAffineLayerWithoutBias<Scalar>>
+                             (numberOfInputs(),
+                              numberOfOutputs(),
+                              activationFunction);
+                 },
+                 activationFunction);
+
+        layer->setWeights(weights);
+        layer->setBiases(biases);
+
+        return layer;
+    }
+
+    //------------------------------------------------------------- | Traits <<<
+    template <typename Scalar>
+    int BasicVariantAffineLayer<Scalar>::numberOfInputs
+            () const
+    {
+        return weights.cols();
+    }
+
+    template <typename Scalar>
+    int BasicVariantAffineLayer<Scalar>::numberOfOutputs
+            () const
+    {
+        return weights.rows();
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    template <typename Scalar>
+    typename BasicVariantAffineLayer<Scalar>::ActivationFunction
+    BasicVariantAffineLayer<Scalar>::toActivationFunction
+            (BasicActivationFunction<Scalar> const &activationFunction)
+    {
+        if (auto const sigmoid = dynamic_cast<BasicSigmoid<Scalar> const *>
+                    (&activationFunction))
+            return *sigmoid;
+
+        if (auto const rectifiedLinearUnit
+                    = dynamic_cast<BasicRectifiedLinearUnit<Scalar> const *>
+                            (&activationFunction))
+            return *rectifiedLinearUnit;
+
+        if (auto const parametricRectifiedLinearUnit
+                    = dynamic_cast
+                            <BasicParametricRectifiedLinearUnit<Scalar> const *>
+                            (&activationFunction))
+            return *parametricRectifiedLinearUnit;
+
+        if (auto const identity = dynamic_cast<BasicIdentity<Scalar> const *>
+                    (&activationFunction))
+            return *identity;
+
+        throw std::invalid_argument("Unsupported activation function");
+    }
+
+    template <typename Scalar>
+    AffineLayerSteps<Matrix<Scalar>, Vector<Scalar>>
+    BasicVariantAffineLayer<Scalar>::steps
+            ()
+    {
+        return { weights,
+                 deltaWeights,
+                 momentumWeights,
+                 biases,
+                 deltaBiases,
+                 momentumBiases,
+                 currentNumberOfSteps,
+                 isBiasEnabled };
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicVariantAffineLayer<float>;
+    template class BasicVariantAffineLayer<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,111 @@
+#ifndef IAD_2A_VARIANT_AFFINE_LAYER_HPP
+#define IAD_2A_VARIANT_AFFINE_LAYER_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "affine-layer.hpp"
+#include "affine-layer-steps.hpp"
+#include "activation-function.hpp"
+#include "identity.hpp"
+#include "parametric-rectified-linear-unit.hpp"
+#include "rectified-linear-unit.hpp"
+#include "sigmoid.hpp"
+
+#include <Eigen/Eigen>
+#include <memory>
+#include <variant>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    ///////////////////////////////////////// | Class: BasicVariantAffineLayer <
+    // Affine layer whose activation function is one of a closed set of types
+    // held by value. Activations are dispatched with std::visit on final
+    // classes, so there are no virtual calls and nothing is allocated.
+    template <typename Scalar>
+    class BasicVariantAffineLayer final
+    {
+    public:
+        //=========================================================== | Types <<
+        using ActivationFunction
+                = std::variant<BasicSigmoid<Scalar>,
+                               BasicRectifiedLinearUnit<Scalar>,
+                               BasicParametricRectifiedLinearUnit<Scalar>,
+                               BasicIdentity<Scalar>>;
+
+        //========================================================= | Methods <<
+        //--------------------------------------------------- | Constructors <<<
+        explicit BasicVariantAffineLayer
+                (int numberOfInputs,
+                 int numberOfOutputs,
+                 ActivationFunction activationFunction,
+                 bool enableBias);
+
+        // Copies parameters of a dynamic layer, whose activation function
+        // has to be one of the supported types
+        explicit BasicVariantAffineLayer
+                (BasicAffineLayer<Scalar> const &layer);
+
+        //---------------------------------------------------------- | Batch <<<
+        void calculateOutputsBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputs) const;
+
+        void activateBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> activatedOutputs) const;
+
+        void activateWithDerivativeBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> activatedOutputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> outputsDerivative) const;
+
+        void backpropagateBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar>> backpropagatedErrors)
+                const;
+
+        void calculateNextStepBatch
+                (Eigen::Ref<Eigen::MatrixX<Scalar> const> const &inputs,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &weightedErrors,
+                 Eigen::Ref<Eigen::MatrixX<Scalar> const> const &outputs);
+
+        void update
+                (double learningCoefficient,
+                 double momentumCoefficient);
+
+        //---------------------------------------------------- | Conversions <<<
+        // Dynamic layer with the same parameters and activation function
+        std::unique_ptr<BasicNeuralNetworkLayer<Scalar>> toNeuralNetworkLayer
+                () const;
+
+        //--------------------------------------------------------- | Traits <<<
+        int numberOfInputs
+                () const;
+
+        int numberOfOutputs
+                () const;
+
+    private:
+        //============================================================ | Data <<
+        Eigen::MatrixX<Scalar> weights, deltaWeights, momentumWeights;
+        Eigen::VectorX<Scalar> biases, deltaBiases, momentumBiases;
+        ActivationFunction activationFunction;
+        int currentNumberOfSteps;
+        bool isBiasEnabled;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        static ActivationFunction toActivationFunction
+                (BasicActivationFunction<Scalar> const &activationFunction);
+
+        AffineLayerSteps<Eigen::MatrixX<Scalar>, Eigen::VectorX<Scalar>> steps
+                ();
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using VariantAffineLayer = BasicVariantAffineLayer<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif //IAD_2A_VARIANT_AFFINE_LAYER_HPP
@@ -0,0 +1,357 @@
+///////////////////////////////////////////////////////////////////// | Includes
+#include "variant-neural-network.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+/////////////////////////////////////////////////////////// | Using declarations
+template <typename Scalar>
+using Vector = Eigen::VectorX<Scalar>;
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    /////////////////////////////////////// | Class: BasicVariantNeuralNetwork <
+    //============================================================= | Methods <<
+    //------------------------------------------------------- | Constructors <<<
+    template <typename Scalar>
+    BasicVariantNeuralNetwork<Scalar>::BasicVariantNeuralNetwork
+            (std::vector<Layer> layers)
+            :
+            layers { std::move(layers) }
+    {
+        if (this->layers.empty())
+            throw std::invalid_argument("Network without layers");
+    }
+
+    template <typename Scalar>
+    BasicVariantNeuralNetwork<Scalar>::BasicVariantNeuralNetwork
+            (BasicNeuralNetwork<Scalar> const &neuralNetwork)
+            :
+            BasicVariantNeuralNetwork { toLayers(neuralNetwork) }
+    {
+    }
+
+    template <typename Scalar>
+    BasicVariantNeuralNetwork<Scalar>::BasicVariantNeuralNetwork
+            (std::string const &filename)
+            :
+            BasicVariantNeuralNetwork
+                    { toLayers(BasicNeuralNetwork<Scalar> { filename }) }
+    {
+    }
+
+    //---------------------------------------------------------- | Operators <<<
+    template <typename Scalar>
+    Vector<Scalar> BasicVariantNeuralNetwork<Scalar>::operator()
+            (Vector<Scalar> const &inputs) const
+    {
+        return feedForward(inputs);
+    }
+
+    //----------------------------------------------------- | Main behaviour <<<
+    template <typename Scalar>
+    Vector<Scalar> BasicVariantNeuralNetwork<Scalar>::feedForward
+            (Vector<Scalar> const &inputs) const
+    {
+        Vector<Scalar> neurons = inputs;
+
+        for (auto const &layer
+                : layers)
+        {
+            std::visit([&neurons](auto const &layer)
+                       {
+                           Vector<Scalar> outputs { layer.numberOfOutputs() };
+
+                           layer.calculateOutputsBatch(neurons, outputs);
+
+                           neurons.resize(outputs.size());
+                           layer.activateBatch(outputs, neurons);
+                       },
+                       layer);
+        }
+
+        return neurons;
+    }
+
+    template <typename Scalar>
+    double BasicVariantNeuralNetwork<Scalar>::trainOnEpoch
+            (std::vector<TrainingExample> const &trainingExamples,
+             double const learningCoefficient,
+             double const momentumCoefficient,
+             int const batchSize)
+    {
+        Workspace workspace
+                { numbersOfNeurons(), std::max(batchSize, 1) };
+
+        double cost = 0.0;
+
+        for (auto firstExample = trainingExamples.cbegin();
+             firstExample != trainingExamples.cend();)
+        {
+            auto const lastExample
+                    = firstExample
+                      + std::min<std::ptrdiff_t>
+                              (std::max(batchSize, 1),
+                               trainingExamples.cend() - firstExample);
+
+            cost += accumulateStepsOnBatch(workspace,
+                                           firstExample,
+                                           lastExample)
+                    / trainingExamples.size();
+
+            // Update layers once per batch
+            for (auto &layer
+                    : layers)
+            {
+                std::visit([&](auto &layer)
+                           {
+                               layer.update(learningCoefficient,
+                                            momentumCoefficient);
+                           },
+                           layer);
+            }
+
+            firstExample = lastExample;
+        }
+
+        return cost;
+    }
+
+    template <typename Scalar>
+    double BasicVariantNeuralNetwork<Scalar>::test
+            (std::vector<TrainingExample> const &testingExamples,
+             int const batchSize) const
+    {
+        Workspace workspace
+                { numbersOfNeurons(), std::max(batchSize, 1) };
+
+        double cost = 0.0;
+
+        for (auto firstExample = testingExamples.cbegin();
+             firstExample != testingExamples.cend();)
+        {
+            auto const numberOfColumns
+                    = std::min<std::ptrdiff_t>
+                            (std::max(batchSize, 1),
+                             testingExamples.cend() - firstExample);
+
+            for (Eigen::Index column = 0;
+                 column < numberOfColumns;
+                 ++column, ++firstExample)
+            {
+                workspace.neurons.front().col(column) = firstExample->inputs;
+                workspace.errors.back().col(column) = firstExample->outputs;
+            }
+
+            propagateForward(workspace, numberOfColumns, false);
+
+            cost += (workspace.errors.back().leftCols(numberOfColumns)
+                     - workspace.neurons.back().leftCols(numberOfColumns))
+                            .squaredNorm()
+                    / testingExamples.size();
+        }
+
+        return cost;
+    }
+
+    template <typename Scalar>
+    void BasicVariantNeuralNetwork<Scalar>::saveToFile
+            (std::string const &filename) const
+    {
+        toNeuralNetwork().saveToFile(filename);
+    }
+
+    template <typename Scalar>
+    void BasicVariantNeuralNetwork<Scalar>::readFromFile
+            (std::string const &filename)
+    {
+        *this = BasicVariantNeuralNetwork { filename };
+    }
+
+    //-------------------------------------------------------- | Conversions <<<
+    template <typename Scalar>
+    BasicNeuralNetwork<Scalar>
+    BasicVariantNeuralNetwork<Scalar>::toNeuralNetwork
+            () const
+    {
+        std::vector<std::unique_ptr<BasicNeuralNetworkLayer<Scalar>>>
+                neuralNetworkLayers;
+
+        for (auto const &layer
+                : layers)
+        {
+            if (auto const affineLayer
+                        = std::get_if<BasicVariantAffineLayer<Scalar>>
+                                (&layer))
+                neuralNetworkLayers.emplace_back
+                        (affineLayer->toNeuralNetworkLayer());
+            else
+                neuralNetworkLayers.emplace_back
+                        (std::get<BasicRadialBasisFunctionLayer<Scalar>>
+                                 (layer).clone());
+        }
+
+        return BasicNeuralNetwork<Scalar> { std::move(neuralNetworkLayers) };
+    }
+
+    //--------------------------------------------------- | Helper functions <<<
+    template <typename Scalar>
+    std::vector<typename BasicVariantNeuralNetwork<Scalar>::Layer>
+    BasicVariantNeuralNetwork<Scalar>::toLayers
+            (BasicNeuralNetwork<Scalar> const &neuralNetwork)
+    {
+        std::vector<Layer> layers;
+
+        for (auto const &layer
+                : neuralNetwork.layers)
+        {
+            if (auto const affineLayer
+                        = dynamic_cast<BasicAffineLayer<Scalar> const *>
+                                (layer.get()))
+                layers.emplace_back(std::in_place_index<0>, *affineLayer);
+            else if (auto const radialBasisFunctionLayer
+                             = dynamic_cast
+                                     <BasicRadialBasisFunctionLayer<Scalar>
+                                      const *>(layer.get()))
+                layers.emplace_back(std::in_place_index<1>,
+                                    *radialBasisFunctionLayer);
+            else
+                throw std::invalid_argument("Unsupported layer type");
+        }
+
+        return layers;
+    }
+
+    template <typename Scalar>
+    std::vector<int> BasicVariantNeuralNetwork<Scalar>::numbersOfNeurons
+            () const
+    {
+        std::vector<int> numbersOfNeurons
+                { std::visit([](auto const &layer)
+                             {
+                                 return layer.numberOfInputs();
+                             },
+                             layers.front()) };
+
+        for (auto const &layer
+                : layers)
+            numbersOfNeurons.push_back
+                    (std::visit([](auto const &layer)
+                                {
+                                    return layer.numberOfOutputs();
+                                },
+                                layer));
+
+        return numbersOfNeurons;
+    }
+
+    template <typename Scalar>
+    void BasicVariantNeuralNetwork<Scalar>::propagateForward
+            (Workspace &workspace,
+             Eigen::Index const numberOfColumns,
+             bool const calculateDerivatives) const
+    {
+        for (std::size_t i = 0; i < layers.size(); ++i)
+        {
+            std::visit([&](auto const &layer)
+                       {
+                           auto const inputs = workspace.neurons[i]
+                                   .leftCols(numberOfColumns);
+                           auto outputs = workspace.outputs[i]
+                                   .leftCols(numberOfColumns);
+                           auto neurons = workspace.neurons[i + 1]
+                                   .leftCols(numberOfColumns);
+
+                           layer.calculateOutputsBatch(inputs, outputs);
+
+                           if (calculateDerivatives)
+                               layer.activateWithDerivativeBatch
+                                       (outputs,
+                                        neurons,
+                                        workspace.outputsDerivatives[i]
+                                                .leftCols(numberOfColumns));
+                           else
+                               layer.activateBatch(outputs, neurons);
+                       },
+                       layers[i]);
+        }
+    }
+
+    template <typename Scalar>
+    double BasicVariantNeuralNetwork<Scalar>::accumulateStepsOnBatch
+            (Workspace &workspace,
+             typename std::vector<TrainingExample>::const_iterator
+             const firstExample,
+             typename std::vector<TrainingExample>::const_iterator
+             const lastExample)
+    {
+        auto const numberOfColumns = lastExample - firstExample;
+
+        // Pack the batch into the workspace, one training example per column
+        for (auto[example, column]
+             = std::make_tuple(firstExample, 0);
+             example != lastExample;
+             ++example, ++column)
+        {
+            workspace.neurons.front().col(column) = example->inputs;
+            workspace.errors.back().col(column) = example->outputs;
+        }
+
+        auto lastLayerErrors
+                = workspace.errors.back().leftCols(numberOfColumns);
+
+        propagateForward(workspace, numberOfColumns, true);
+
+        lastLayerErrors -= workspace.neurons.back().leftCols(numberOfColumns);
+
+        // Errors of the network's inputs are not needed for training
+        for (std::size_t i = layers.size(); i-- > 0;)
+        {
+            std::visit([&](auto &layer)
+                       {
+                           auto weightedErrors = workspace.weightedErrors[i]
+                                   .leftCols(numberOfColumns);
+
+                           weightedErrors.array()
+                                   = workspace.errors[i + 1]
+                                             .leftCols(numberOfColumns)
+                                             .array()
+                                     * workspace.outputsDerivatives[i]
+                                             .leftCols(numberOfColumns)
+                                             .array();
+
+                           if (i > 0)
+                               layer.backpropagateBatch
+                                       (workspace.neurons[i]
+                                                .leftCols(numberOfColumns),
+                                        weightedErrors,
+                                        workspace.neurons[i + 1]
+                                                .leftCols(numberOfColumns),
+                                        workspace.errors[i]
+                                                .leftCols(numberOfColumns));
+
+                           layer.calculateNextStepBatch
+                                   (workspace.neurons[i]
+                                            .leftCols(numberOfColumns),
+                                    weightedErrors,
+                                    workspace.neurons[i + 1]
+                                            .leftCols(numberOfColumns));
+                       },
+                       layers[i]);
+        }
+
+        // Return the batch's total cost
+        return lastLayerErrors.array().square().sum();
+    }
+
+    //============================================== | Explicit instantiation <<
+    template class BasicVariantNeuralNetwork<float>;
+    template class BasicVariantNeuralNetwork<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
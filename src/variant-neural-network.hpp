@@ -0,0 +1,110 @@
+#ifndef IAD_2A_VARIANT_NEURAL_NETWORK_HPP
+#define IAD_2A_VARIANT_NEURAL_NETWORK_HPP
+///////////////////////////////////////////////////////////////////// | Includes
+#include "neural-network.hpp"
+#include "radial-basis-function-layer.hpp"
+#include "training-example.hpp"
+#include "variant-affine-layer.hpp"
+
+#include <Eigen/Eigen>
+#include <string>
+#include <variant>
+#include <vector>
+
+//////////////////////////////////////////////////// | Namespace: NeuralNetworks
+namespace NeuralNetworks
+{
+    /////////////////////////////////////// | Class: BasicVariantNeuralNetwork <
+    // Network over a closed set of layer types held by value in a variant.
+    // Layers are dispatched with std::visit on final classes instead of
+    // virtual calls through pointers. Converts from and to NeuralNetwork and
+    // shares its file format.
+    template <typename Scalar>
+    class BasicVariantNeuralNetwork final
+    {
+    public:
+        //=========================================================== | Types <<
+        using TrainingExample = BasicTrainingExample<Scalar>;
+
+        using Layer = std::variant<BasicVariantAffineLayer<Scalar>,
+                                   BasicRadialBasisFunctionLayer<Scalar>>;
+
+        //======================================================= | Behaviour <<
+        //--------------------------------------------------- | Constructors <<<
+        // Throws if there are no layers
+        explicit BasicVariantNeuralNetwork
+                (std::vector<Layer> layers);
+
+        // Layers have to be affine, with a supported activation function,
+        // or radial basis function layers
+        explicit BasicVariantNeuralNetwork
+                (BasicNeuralNetwork<Scalar> const &neuralNetwork);
+
+        explicit BasicVariantNeuralNetwork
+                (std::string const &filename);
+
+        //------------------------------------------------------ | Operators <<<
+        Eigen::VectorX<Scalar> operator()
+                (Eigen::VectorX<Scalar> const &inputs) const;
+
+        //----------------------------------------------------------- | Main <<<
+        Eigen::VectorX<Scalar> feedForward
+                (Eigen::VectorX<Scalar> const &inputs) const;
+
+        // Trains on the examples in the given order and returns the epoch's
+        // cost, as reported by NeuralNetwork::train
+        double trainOnEpoch
+                (std::vector<TrainingExample> const &trainingExamples,
+                 double learningCoefficient,
+                 double momentumCoefficient = 0.0,
+                 int batchSize = 1);
+
+        // Mean cost over the examples, as NeuralNetwork::test's global cost
+        double test
+                (std::vector<TrainingExample> const &testingExamples,
+                 int batchSize = 64) const;
+
+        void saveToFile
+                (std::string const &filename) const;
+
+        void readFromFile
+                (std::string const &filename);
+
+        //---------------------------------------------------- | Conversions <<<
+        BasicNeuralNetwork<Scalar> toNeuralNetwork
+                () const;
+
+    private:
+        //=========================================================== | Types <<
+        using Workspace = typename BasicNeuralNetwork<Scalar>::Workspace;
+
+        //============================================================ | Data <<
+        std::vector<Layer> layers;
+
+        //======================================================= | Behaviour <<
+        //----------------------------------------------- | Helper functions <<<
+        static std::vector<Layer> toLayers
+                (BasicNeuralNetwork<Scalar> const &neuralNetwork);
+
+        std::vector<int> numbersOfNeurons
+                () const;
+
+        void propagateForward
+                (Workspace &workspace,
+                 Eigen::Index numberOfColumns,
+                 bool calculateDerivatives) const;
+
+        double accumulateStepsOnBatch
+                (Workspace &workspace,
+                 typename std::vector<TrainingExample>::const_iterator
+                 firstExample,
+                 typename std::vector<TrainingExample>::const_iterator
+                 lastExample);
+    };
+
+    //////////////////////////////////////////////////////////////// | Aliases <
+    using VariantNeuralNetwork = BasicVariantNeuralNetwork<double>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif //IAD_2A_VARIANT_NEURAL_NETWORK_HPP